@@ -0,0 +1,78 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+// Throughput of a tight numerical loop with an assertion on each iteration:
+// no check, the former inline expansion of LogAssert, the outlined LogAssert and LogAssertDebug.
+
+#include "Logger.h"
+
+#include <cmath>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+
+
+// what LogAssert used to expand to, for comparison
+#define LegacyLogAssert(assertion_, errorMessage_) \
+  if(not (assertion_)){(LogError << "(" << __PRETTY_FUNCTION__ << "): "<< errorMessage_ << std::endl).throwError(#assertion_ ": " #errorMessage_);}
+
+
+namespace {
+
+  // the checks sit in small helpers, as in real code: their size decides if they get inlined in the loop
+  inline double getNoCheck(const std::vector<double>& values_, size_t i_){
+    return values_[i_] * 0.5 + 1.;
+  }
+  inline double getLegacyCheck(const std::vector<double>& values_, size_t i_){
+    LegacyLogAssert(std::isfinite(values_[i_]), "invalid value " << values_[i_] << " at index " << i_);
+    return values_[i_] * 0.5 + 1.;
+  }
+  inline double getAssert(const std::vector<double>& values_, size_t i_){
+    LogAssert(std::isfinite(values_[i_]), "invalid value " << values_[i_] << " at index " << i_);
+    return values_[i_] * 0.5 + 1.;
+  }
+  inline double getAssertDebug(const std::vector<double>& values_, size_t i_){
+    LogAssertDebug(std::isfinite(values_[i_]), "invalid value " << values_[i_] << " at index " << i_);
+    return values_[i_] * 0.5 + 1.;
+  }
+
+  struct Result{
+    const char* name;
+    double nsPerIteration;
+    double sum; // printed: the loops can't be optimized away
+  };
+
+  template<typename GetFct> Result measure(const char* name_, const std::vector<double>& values_, int nRepeats_, GetFct get_){
+    Result result{name_, 0, 0};
+    auto start = std::chrono::steady_clock::now();
+    for( int iRepeat = 0 ; iRepeat < nRepeats_ ; iRepeat++ ){
+      for( size_t i = 0 ; i < values_.size() ; i++ ){ result.sum += get_(values_, i); }
+    }
+    auto durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    result.nsPerIteration = double(durationNs) / (double(nRepeats_) * double(values_.size()));
+    return result;
+  }
+
+}
+
+int main(int argc, char** argv){
+
+  int nRepeats = ( argc > 1 ? std::atoi(argv[1]) : 2000 );
+  std::vector<double> values(1 << 14);
+  for( size_t i = 0 ; i < values.size() ; i++ ){ values[i] = std::sin(double(i)); }
+
+  // lambdas: the helpers can be inlined in the loop
+  std::vector<Result> resultList;
+  resultList.emplace_back(measure("no check", values, nRepeats, [](const std::vector<double>& v_, size_t i_){ return getNoCheck(v_, i_); }));
+  resultList.emplace_back(measure("former LogAssert", values, nRepeats, [](const std::vector<double>& v_, size_t i_){ return getLegacyCheck(v_, i_); }));
+  resultList.emplace_back(measure("LogAssert", values, nRepeats, [](const std::vector<double>& v_, size_t i_){ return getAssert(v_, i_); }));
+  resultList.emplace_back(measure("LogAssertDebug", values, nRepeats, [](const std::vector<double>& v_, size_t i_){ return getAssertDebug(v_, i_); }));
+
+  LogInfo.fmt("{} iterations per loop, LogAssertDebug {}", static_cast<unsigned long long>(nRepeats) * values.size(),
+              LOGGER_ENABLE_ASSERT_DEBUG ? "enabled" : "compiled out");
+  for( auto& result : resultList ){
+    LogInfo.fmt("{:18s} {:8.3f} ns/iteration (checksum {:.1f})", result.name, result.nsPerIteration, result.sum);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+// Compile-time cost of the headers, measured by compiling generated source files:
+// - header parse time: a source file with no print statement, compiled with -fsyntax-only
+// - fixed code size: code of this empty source file (what every source file pays for including the header)
+// - code size per site: extra code of a source file with N print statements, divided by N
+// Logger.h and LoggerLite.h are compared. The code size is read from the ELF sections (file size otherwise).
+
+#include "Logger.h"
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+
+
+namespace {
+
+  void printUsage(const char* exeName_){
+    std::fprintf(stderr,
+      "Usage: %s [options]\n"
+      "  --sites <n>       print statements of the generated source file (default: 200)\n"
+      "  --repeats <n>     compilations per measurement, the fastest is kept (default: 3)\n"
+      "  --work-dir <dir>  where the generated files go (default: current folder)\n",
+      exeName_
+    );
+  }
+
+  std::string writeSource(const std::string& workDir_, const std::string& headerName_, int nSites_){
+    std::string filePath{workDir_ + "/headerCost_" + headerName_ + "_" + std::to_string(nSites_) + ".cpp"};
+    std::ofstream file{filePath};
+    file << "#include \"" << headerName_ << "\"\n";
+    for( int iSite = 0 ; iSite < nSites_ ; iSite++ ){
+      file << "void printSite" << iSite << "(int i_, double x_){ "
+           << "LogInfo << \"site " << iSite << ": iteration \" << i_ << \" value \" << x_ << std::endl; }\n";
+    }
+    return filePath;
+  }
+
+  double compile(const std::string& options_, const std::string& sourcePath_, int nRepeats_){
+    // the fastest of the repeats, in seconds (negative if the compilation failed)
+    std::string command{LOGGER_BENCHMARK_CXX_COMPILER " -std=c++" + std::to_string(LOGGER_BENCHMARK_CXX_STANDARD)};
+    command += " -I\"" LOGGER_BENCHMARK_INCLUDE_DIR "\" " + options_ + " \"" + sourcePath_ + "\"";
+    double bestTime{-1};
+    for( int iRepeat = 0 ; iRepeat < nRepeats_ ; iRepeat++ ){
+      auto start = std::chrono::steady_clock::now();
+      if( std::system(command.c_str()) != 0 ) return -1;
+      double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      if( bestTime < 0 or time < bestTime ) bestTime = time;
+    }
+    return bestTime;
+  }
+
+  uint64_t readUint(const std::string& data_, size_t offset_, size_t size_){
+    // little endian
+    uint64_t value{0};
+    for( size_t iByte = size_ ; iByte > 0 ; iByte-- ){ value = (value << 8) | uint8_t(data_[offset_ + iByte - 1]); }
+    return value;
+  }
+
+  uint64_t getCodeSize(const std::string& objectPath_){
+    std::ifstream file{objectPath_, std::ios::binary};
+    std::string data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    // 64-bit little endian ELF: sum of the executable sections
+    if( data.size() < 64 or data.compare(0, 4, "\x7f" "ELF") != 0 or data[4] != 2 or data[5] != 1 ) return data.size();
+    uint64_t sectionOffset = readUint(data, 0x28, 8);
+    uint64_t sectionEntrySize = readUint(data, 0x3A, 2);
+    uint64_t nSections = readUint(data, 0x3C, 2);
+    uint64_t codeSize{0};
+    for( uint64_t iSection = 0 ; iSection < nSections ; iSection++ ){
+      size_t entry = size_t(sectionOffset + iSection * sectionEntrySize);
+      if( entry + 0x28 > data.size() ) break;
+      const uint64_t executableFlag{0x4};
+      if( readUint(data, entry + 0x08, 8) & executableFlag ) codeSize += readUint(data, entry + 0x20, 8);
+    }
+    return codeSize;
+  }
+
+}
+
+int main(int argc, char** argv){
+
+  int nSites{200};
+  int nRepeats{3};
+  std::string workDir{"."};
+
+  for( int iArg = 1 ; iArg < argc ; iArg++ ){
+    std::string arg{argv[iArg]};
+    bool hasValue{iArg + 1 < argc};
+    if     ( arg == "--sites" and hasValue ){ nSites = std::max(1, std::atoi(argv[++iArg])); }
+    else if( arg == "--repeats" and hasValue ){ nRepeats = std::max(1, std::atoi(argv[++iArg])); }
+    else if( arg == "--work-dir" and hasValue ){ workDir = argv[++iArg]; }
+    else if( arg == "-h" or arg == "--help" ){ printUsage(argv[0]); return EXIT_SUCCESS; }
+    else{ printUsage(argv[0]); return EXIT_FAILURE; }
+  }
+
+  LogInfo.fmt("Compiler: {} (C++{}), {} print statements", LOGGER_BENCHMARK_CXX_COMPILER, LOGGER_BENCHMARK_CXX_STANDARD, nSites);
+  for( const std::string headerName : {"Logger.h", "LoggerLite.h"} ){
+    std::string emptySource{writeSource(workDir, headerName, 0)};
+    std::string sitesSource{writeSource(workDir, headerName, nSites)};
+    std::string emptyObject{emptySource + ".o"};
+    std::string sitesObject{sitesSource + ".o"};
+
+    double parseTime = compile("-fsyntax-only", emptySource, nRepeats);
+    double emptyCompileTime = compile("-O2 -c -o \"" + emptyObject + "\"", emptySource, nRepeats);
+    double sitesCompileTime = compile("-O2 -c -o \"" + sitesObject + "\"", sitesSource, nRepeats);
+    LogThrowIf(parseTime < 0 or emptyCompileTime < 0 or sitesCompileTime < 0, "Could not compile the sources generated for " << headerName);
+
+    uint64_t emptyCodeSize = getCodeSize(emptyObject);
+    uint64_t sitesCodeSize = getCodeSize(sitesObject);
+    LogInfo.fmt("{:13s} parse {:7.3f} s | -O2 compile {:7.3f} s, with the sites {:7.3f} s | fixed code {:7d} B, per site {:7.1f} B",
+                headerName, parseTime, emptyCompileTime, sitesCompileTime,
+                emptyCodeSize, double(sitesCodeSize - std::min(sitesCodeSize, emptyCodeSize)) / nSites);
+
+    for( auto& path : {emptySource, sitesSource, emptyObject, sitesObject} ){ std::remove(path.c_str()); }
+  }
+
+  return EXIT_SUCCESS;
+}
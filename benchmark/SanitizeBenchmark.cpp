@@ -0,0 +1,76 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+// Throughput of the payload sanitization (see LoggerUtils::PayloadSanitizing) on typical log lines:
+// the scan alone, escape and strip on clean and on dirty text, and LoggerUtils::stripStringUnicode for comparison.
+
+#include "Logger.h"
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+
+
+namespace {
+
+  std::vector<std::string> buildLines(size_t nLines_, bool isDirty_){
+    // ~100 bytes per line, some UTF-8. Dirty lines carry a color code and a control character.
+    std::vector<std::string> lineList;
+    lineList.reserve(nLines_);
+    for( size_t iLine = 0 ; iLine < nLines_ ; iLine++ ){
+      std::string line{"request " + std::to_string(iLine) + " from client \"caf\xc3\xa9-" + std::to_string(iLine % 97) + "\": "};
+      line += "GET /api/v1/items?page=" + std::to_string(iLine % 13) + "&sort=name 200 OK (12.5 ms)";
+      if( isDirty_ ){ line.insert(line.size() / 2, "\x1b[31m\r"); }
+      lineList.emplace_back(line);
+    }
+    return lineList;
+  }
+
+  template<typename Fct> double measureGBps(const std::vector<std::string>& lineList_, int nRepeats_, Fct fct_){
+    size_t nBytes{0};
+    for( auto& line : lineList_ ){ nBytes += line.size(); }
+    auto start = std::chrono::steady_clock::now();
+    for( int iRepeat = 0 ; iRepeat < nRepeats_ ; iRepeat++ ){
+      for( auto& line : lineList_ ){ fct_(line); }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return double(nBytes) * nRepeats_ / seconds / 1E9;
+  }
+
+}
+
+int main(int argc, char** argv){
+
+  int nRepeats = ( argc > 1 ? std::atoi(argv[1]) : 200 );
+  const size_t nLines{10000};
+
+  size_t checksum{0}; // printed: the calls can't be optimized away
+  std::string out;
+  LogInfo.fmt("{} lines, {} repeats, SIMD: {}", nLines, nRepeats, LOGGER_USE_AVX2 ? "AVX2" : LOGGER_USE_SSE2 ? "SSE2" : "none");
+  for( bool isDirty : {false, true} ){
+    auto lineList = buildLines(nLines, isDirty);
+    // the scan stops at the first unsafe byte: on dirty text it only covers the first half of the lines
+    double scanGBps = measureGBps(lineList, nRepeats, [&](const std::string& line_){
+      checksum += LoggerUtils::findUnsafeChar(line_.data(), line_.size());
+    });
+    double escapeGBps = measureGBps(lineList, nRepeats, [&](const std::string& line_){
+      out.clear();
+      LoggerUtils::appendSanitized(out, line_.data(), line_.size(), LoggerUtils::PayloadSanitizing::ESCAPE);
+      checksum += out.size();
+    });
+    double stripGBps = measureGBps(lineList, nRepeats, [&](const std::string& line_){
+      out.clear();
+      LoggerUtils::appendSanitized(out, line_.data(), line_.size(), LoggerUtils::PayloadSanitizing::STRIP);
+      checksum += out.size();
+    });
+    double legacyGBps = measureGBps(lineList, std::max(1, nRepeats / 20), [&](const std::string& line_){
+      checksum += LoggerUtils::stripStringUnicode(line_).size();
+    });
+    LogInfo.fmt("{:5s} text: scan {:6.2f} GB/s | escape {:6.2f} GB/s | strip {:6.2f} GB/s | stripStringUnicode {:6.3f} GB/s",
+                isDirty ? "dirty" : "clean", scanGBps, escapeGBps, stripGBps, legacyGBps);
+  }
+  LogInfo << "checksum " << checksum << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -57,6 +57,8 @@ int main(){
   *i_ptr = 99;
   LogInfo << R"(-> LogInfo("Here is a pointer \"%p\", followed by its int value: %i", i_ptr, *i_ptr);)" << std::endl;
   LogInfo("Here is a pointer \"%p\", followed by its int value: %i", i_ptr, *i_ptr);
+  LogInfo << R"(-> LogInfo.fmt("Or with {{}} placeholders: {} / {:.3f} / {:x}", "str", 3.14159, *i_ptr);)" << std::endl;
+  LogInfo.fmt("Or with {{}} placeholders: {} / {:.3f} / {:x}", "str", 3.14159, *i_ptr);
   delete i_ptr;
 
   LogInfo.quietLineJump();
@@ -184,6 +186,22 @@ int main(){
 
   Logger::quietLineJump();
 
+  {
+    LogProgress progress("Progress bar shared by 4 threads", 4000);
+    std::vector<std::thread> workerList;
+    for( int iThread = 0 ; iThread < 4 ; iThread++ ){
+      workerList.emplace_back([&]{
+        for( int iStep = 0 ; iStep < 1000 ; iStep++ ){
+          std::this_thread::sleep_for(std::chrono::milliseconds(2));
+          progress.increment();
+        }
+      });
+    }
+    for( auto& worker : workerList ){ worker.join(); }
+  }
+
+  Logger::quietLineJump();
+
 #endif
 
 
@@ -11,6 +11,16 @@
 
 #include "implementation/LoggerParameters.h"
 #include "implementation/LoggerUtils.h"
+#include "implementation/LoggerSinks.h"
+#include "implementation/LoggerShards.h"
+#include "implementation/LoggerContext.h"
+#include "implementation/LoggerTimers.h"
+#include "implementation/LoggerFormat.h"
+#include "implementation/LoggerHex.h"
+#include "implementation/LoggerStats.h"
+#include "implementation/LoggerFilters.h"
+#include "implementation/LoggerMetrics.h"
+#include "implementation/LoggerStackTrace.h"
 
 #include <mutex>
 #include <string>
@@ -47,32 +57,68 @@
 #define LogTraceOnce            (LogTraceImpl( true, true ))
 
 // To make assertions
-#define LogThrowIf2(isThrowing_, errorMessage_)  if(isThrowing_){(LogError << "(" << __PRETTY_FUNCTION__ << "): "<< errorMessage_ << std::endl).throwError(#isThrowing_ ": " #errorMessage_);}
+#define LogThrowIf2(isThrowing_, errorMessage_)  if(LOGGER_UNLIKELY(isThrowing_)){ LogCallSiteImpl(#isThrowing_ ": " #errorMessage_); Logger::throwErrorAt(LogCallSiteName, LogCallSiteMessageImpl(errorMessage_)); }
 #define LogThrowIf1(isThrowing_) LogThrowIf2(isThrowing_, #isThrowing_)
 #define LogThrowIf(...) GET_OVERLOADED_MACRO2(__VA_ARGS__, LogThrowIf2, LogThrowIf1)(__VA_ARGS__)
 #define LogAssert(assertion_, errorMessage_)    LogThrowIf(not (assertion_), errorMessage_)
 #define LogThrow(errorMessage_)                 LogThrowIf(true, errorMessage_)
 
+// Only checked in debug builds: compiled out with NDEBUG (see LOGGER_ENABLE_ASSERT_DEBUG)
+#if LOGGER_ENABLE_ASSERT_DEBUG
+#define LogAssertDebug(assertion_, errorMessage_) LogAssert(assertion_, errorMessage_)
+#else
+#define LogAssertDebug(assertion_, errorMessage_) do{ (void) sizeof(not (assertion_)); } while(false) // not evaluated
+#endif
+
 // Assertion using std::exit() instead of throw
-#define LogExitIf2(isExit_, errorMessage_)  if(isExit_){(LogError << "(" << __PRETTY_FUNCTION__ << "): "<< errorMessage_ << std::endl).triggerExit(#isExit_ ": " #errorMessage_);}
+#define LogExitIf2(isExit_, errorMessage_)  if(LOGGER_UNLIKELY(isExit_)){ LogCallSiteImpl(#isExit_ ": " #errorMessage_); Logger::triggerExitAt(LogCallSiteName, LogCallSiteMessageImpl(errorMessage_)); }
 #define LogExitIf1(isExit_) LogExitIf2(isExit_, #isExit_)
 #define LogExitIf(...) GET_OVERLOADED_MACRO2(__VA_ARGS__, LogExitIf2, LogExitIf1)(__VA_ARGS__)
 #define LogExit(errorMessage_)                 LogExitIf(true, errorMessage_)
 
 // Within loops
-#define LogContinueIf2(isContinue_, continueMessage_)  if(isContinue_){(LogWarning << "(" << __PRETTY_FUNCTION__ << "): "<< continueMessage_ << std::endl); continue; }
+#define LogContinueIf2(isContinue_, continueMessage_)  if(LOGGER_UNLIKELY(isContinue_)){ LogCallSiteImpl(#isContinue_); Logger::printWarningAt(LogCallSiteName, LogCallSiteMessageImpl(continueMessage_)); continue; }
 #define LogContinueIf1(isContinue_)  LogContinueIf2(isContinue_, #isContinue_)
 #define LogContinueIf(...) GET_OVERLOADED_MACRO2(__VA_ARGS__, LogContinueIf2, LogContinueIf1)(__VA_ARGS__)
 
 // Within functions
-#define LogReturnIf3(isReturn_, returnMessage_, returnObj_)  if(isReturn_){(LogWarning << "(" << __PRETTY_FUNCTION__ << "): "<< returnMessage_ << std::endl); return returnObj_; }
+#define LogReturnIf3(isReturn_, returnMessage_, returnObj_)  if(LOGGER_UNLIKELY(isReturn_)){ LogCallSiteImpl(#isReturn_); Logger::printWarningAt(LogCallSiteName, LogCallSiteMessageImpl(returnMessage_)); return returnObj_; }
 #define LogReturnIf2(isReturn_, returnMessage_)  LogReturnIf3(isReturn_, returnMessage_, )
 #define LogReturnIf1(isReturn_)  LogReturnIf2(isReturn_, (#isReturn_))
 #define LogReturnIf(...) GET_OVERLOADED_MACRO3(__VA_ARGS__, LogReturnIf3, LogReturnIf2, LogReturnIf1)(__VA_ARGS__)
 
+// The failing branch of the checks above is outlined: the call site only keeps the test and a call to a cold reporter,
+// which receives a static descriptor of the call and a lambda streaming the message
+#define LogCallSiteName MAKE_VARNAME_LINE(loggerCallSite)
+#define LogCallSiteImpl(conditionStr_) static const LoggerUtils::CallSite LogCallSiteName = {__FILE__, __LINE__, __PRETTY_FUNCTION__, conditionStr_}
+#define LogCallSiteMessageImpl(message_) [&](Logger& logger_){ logger_ << message_; }
+
 #define LogScopeIndent Logger::ScopedIndent MAKE_VARNAME_LINE(scopeIndentTempObj);
-#define LogIndent Logger::setIndentStr(Logger::getIndentStr() + "  ")
-#define LogUnIndent Logger::setIndentStr(Logger::getIndentStr().substr(0, Logger::getIndentStr().size()-2))
+#define LogIndent Logger::increaseIndent()
+#define LogUnIndent Logger::decreaseIndent()
+
+// Aggregates the duration of the enclosing scope into a histogram, see Logger::dumpTimers(). Usage: LogScopeTimer("readEvent");
+#define LogScopeTimer(name_) static LoggerUtils::TimerSite MAKE_VARNAME_LINE(timerSite)(name_); Logger::ScopedTimer MAKE_VARNAME_LINE(scopeTimerTempObj)(MAKE_VARNAME_LINE(timerSite))
+
+// Thread-safe progress report, redrawn at most LOGGER_PROGRESS_REFRESH_RATE times per second.
+// Usage: LogProgress progress("Reading events", nEvents); ... progress.increment(); // from any thread
+#define LogProgress Logger::Progress
+
+// Aggregates a value instead of printing it: one summary line per stat (count, mean, min, max, last) every LOGGER_METRICS_DUMP_INTERVAL seconds,
+// or with Logger::dumpMetrics(). Usage: LogStat("queue.depth", queue.size()); No formatting nor locking at the call site:
+// the periodic summary is printed at the end of the next print statement.
+#define LogStat(name_, value_) do{ static LoggerUtils::MetricSite metricSite(name_, FILENAME, __LINE__); Logger::addStatValue(metricSite, double(value_)); } while(false)
+
+// Bounded printing of containers: LogDebug << LogRange(myVector) << std::endl; or LogRange(myMap, 100), LogRange(begin, end)
+// At most LOGGER_RANGE_MAX_ELEMENTS elements (or the given cap) are printed, the rest is elided with its count
+#define LogRange(...) LoggerUtils::makeRangeView(__VA_ARGS__)
+
+// Hex dump of a binary buffer, one "hexdump -C" row per line: LogTrace << LogHex(buffer, size) << std::endl;
+// Also takes containers (LogHex(myVector)), and a cap on the printed bytes (default LOGGER_HEX_MAX_BYTES)
+#define LogHex(...) LoggerUtils::makeHexView(__VA_ARGS__)
+
+// Mapped diagnostic context, rendered with the {CONTEXT} prefix token. Usage: LogContext ctx("run", runId);
+#define LogContext Logger::ScopedContext
 
 // To set up the logger in a given source file
 #define LoggerInit( lambdaInit ) LoggerInitializerImpl( lambdaInit )
@@ -105,57 +151,122 @@ namespace {
       DEBUG       = 3,
       FULL        = 4
     };
+    struct Config{
+      // Parameters of the source file. A published snapshot is never modified: the setters publish a modified copy,
+      // so that threads printing at the same time keep reading a consistent one without any lock (see refreshStatementConfig()).
+      inline Config(); // from the preprocessor parameters
+      bool isMuted;
+      bool enableColors;
+      bool propagateColorsOnUserHeader;
+      bool cleanLineBeforePrint;
+      bool disablePrintfLineJump;
+      bool writeInOutputFile;
+      bool writeInBinaryOutputFile;
+      LogLevel maxLogLevel;
+      PrefixLevel prefixLevel;
+      std::string prefixFormat;
+      std::string userHeaderStr;
+    };
 
     //! Setters
     // Keep in mind that every parameter you set will be applied only in the context of the source file you're in
     // It is an inherent feature as a **header-only** library
-    inline static void setIsMuted(bool isMuted_){ _isMuted_ = isMuted_; }
-    inline static void setEnableColors(bool enableColors_){ _enableColors_ = enableColors_; }
-    inline static void setCleanLineBeforePrint(bool cleanLineBeforePrint){ _cleanLineBeforePrint_ = cleanLineBeforePrint; }
-    inline static void setPropagateColorsOnUserHeader(bool propagateColorsOnUserHeader_){ _propagateColorsOnUserHeader_ = propagateColorsOnUserHeader_; }
-    inline static void setPrefixLevel(const PrefixLevel &prefixLevel_){ _prefixLevel_ = prefixLevel_; }
-    inline static void setUserHeaderStr(const std::string &userHeaderStr_){ _userHeaderSs_.str(userHeaderStr_); }
-    inline static void setPrefixFormat(const std::string &prefixFormat_){ _prefixFormat_ = prefixFormat_; }
-    inline static void setIndentStr(const std::string &indentStr_){ _indentStr_ = indentStr_; }
-    inline static std::stringstream& getUserHeader(){ return _userHeaderSs_; }
+    // They can be called from any thread, while others are printing (see Config)
+    template<typename ChangeFct> inline static void updateConfig(const ChangeFct& change_); // several parameters at once: Logger::updateConfig([](Logger::Config& config_){ ... });
+    inline static void setIsMuted(bool isMuted_){ updateConfig([&](Config& config_){ config_.isMuted = isMuted_; }); }
+    inline static void setEnableColors(bool enableColors_){ updateConfig([&](Config& config_){ config_.enableColors = enableColors_; }); }
+    inline static void setCleanLineBeforePrint(bool cleanLineBeforePrint){ updateConfig([&](Config& config_){ config_.cleanLineBeforePrint = cleanLineBeforePrint; }); }
+    inline static void setPropagateColorsOnUserHeader(bool propagateColorsOnUserHeader_){ updateConfig([&](Config& config_){ config_.propagateColorsOnUserHeader = propagateColorsOnUserHeader_; }); }
+    inline static void setPrefixLevel(const PrefixLevel &prefixLevel_){ updateConfig([&](Config& config_){ config_.prefixLevel = prefixLevel_; }); }
+    inline static void setUserHeaderStr(const std::string &userHeaderStr_){ updateConfig([&](Config& config_){ config_.userHeaderStr = userHeaderStr_; }); }
+    inline static void setPrefixFormat(const std::string &prefixFormat_){ updateConfig([&](Config& config_){ config_.prefixFormat = prefixFormat_; }); } // "": LOGGER_PREFIX_FORMAT
+    inline static void setIndentStr(const std::string &indentStr_){ _indentState_.set(indentStr_); } // for the calling thread
+    inline static void increaseIndent(){ _indentState_.increase(); }
+    inline static void decreaseIndent(){ _indentState_.decrease(); }
+    inline static void setThreadName(const std::string &threadName_){ LoggerUtils::setThreadName(threadName_); } // for the calling thread
+    inline static void setWriteInOutputFile(bool writeInOutputFile_);
+    inline static void setWriteInBinaryOutputFile(bool writeInBinaryOutputFile_);
+    inline static void setWriteInShardFiles(bool writeInShardFiles_); // one file per thread, for all the source files (LOGGER_SHARD_OUTFILE_NAME_FORMAT)
+    inline static void setAsyncConsole(bool isAsync_); // the console is written by a background thread, see LoggerUtils::AsyncSink
+    inline static void setCollapseRepeatedLines(bool collapseRepeatedLines_){ LoggerUtils::getLogSinkDispatcher().setCollapseRepeatedLines(collapseRepeatedLines_); } // for all the source files
+    inline static void setTimersDumpInterval(double seconds_){ LoggerUtils::getTimerRegistry().setDumpInterval(seconds_); } // 0 to disable
     inline static std::string indent(){ LogIndent; return {}; }
     inline static std::string unIndent(){ LogUnIndent; return {}; }
     inline static void setMaxLogLevel(const Logger& logger_);  // Usage: Logger::setMaxLogLevel(LogDebug);
     inline static void setMaxLogLevel();                       // Usage: LogDebug.setMaxLogLevel();
+    // Runtime filters on the call sites, for all the source files: "ClassExample.cpp:*", "reader*.cpp:100-200", "main.cpp:42"...
+    // The last matching filter sets the max log level of a site, whatever the one of its source file.
+    inline static void addIncludeFilter(const std::string& siteSpec_, const LogLevel& maxLogLevel_ = LogLevel::TRACE); // printed up to maxLogLevel_
+    inline static void addExcludeFilter(const std::string& siteSpec_, const LogLevel& fromLogLevel_ = LogLevel::FATAL); // muted from fromLogLevel_ (all by default)
+    inline static void clearFilters(){ LoggerUtils::getLogFilterRegistry().clear(); }
+    inline static void dumpTimers(); // prints the LogScopeTimer table merged over all threads
+    inline static void resetTimers(){ LoggerUtils::getTimerRegistry().reset(); }
+    inline static void dumpMetrics(); // prints the LogStat summaries of the interval which just ended
+    inline static void setMetricsDumpInterval(double seconds_){ LoggerUtils::getMetricRegistry().setDumpInterval(seconds_); } // 0 to disable
+    inline static void addStatValue(const LoggerUtils::MetricSite& site_, double value_); // called by LogStat
+    inline static void setStatsReportInterval(double seconds_){ LoggerUtils::getStatsRegistry().setReportInterval(seconds_); } // "[Logger] stats" line, 0 to disable
+    inline static void setStatsFile(const std::string& filePath_, double seconds_ = LOGGER_STATS_FILE_INTERVAL){ LoggerUtils::getStatsRegistry().setStatsFile(filePath_, seconds_); } // Prometheus text format
 
     //! Getters
-    inline static bool isCleanLineBeforePrint(){ return _cleanLineBeforePrint_; }
-    inline static bool isMuted(){ return _isMuted_; }
-    inline static int getMaxLogLevelInt(){ return static_cast<int>(_maxLogLevel_); }
-    inline static const std::string& getIndentStr(){ return _indentStr_; }
-    inline static const LogLevel & getMaxLogLevel(){ return _maxLogLevel_; }
+    inline static std::shared_ptr<const Config> getConfig(){ return _config_.load(); } // last published snapshot, valid as long as it is held
+    inline static bool isCleanLineBeforePrint(){ return getConfig()->cleanLineBeforePrint; }
+    inline static bool isMuted(){ return getConfig()->isMuted; }
+    inline static int getMaxLogLevelInt(){ return static_cast<int>(getConfig()->maxLogLevel); }
+    inline static const std::string& getIndentStr(){ return _indentState_.getStr(); }
+    inline static LogLevel getMaxLogLevel(){ return getConfig()->maxLogLevel; }
     inline static LoggerUtils::StreamBufferSupervisor *getStreamBufferSupervisorPtr(){ return _streamBufferSupervisorPtr_; }
+    inline static std::string getOutputFilePath();
+    inline static std::string getBinaryOutputFilePath();
+    inline static LoggerUtils::LoggerStats getStats(){ return LoggerUtils::getLogSinkDispatcher().getStats(); } // self-telemetry, merged over all threads
     inline static std::string getPrefixString();                                // LogWarning.getPrefixString()
     inline static std::string getPrefixString(const Logger& loggerConstructor); // Logger::getPrefixString(LogWarning)
 
     //! Misc
-    inline static void triggerNewLine(){ _isNewLine_ = true; }
+    inline static void triggerNewLine();
     inline static void quietLineJump();
     inline static void moveTerminalCursorBack(int nLines_, bool clearLines_ = false );
     inline static void moveTerminalCursorForward(int nLines_, bool clearLines_ = false );
     inline static void clearLine();
     inline static void printNewLine();
 
+    //! Sinks
+    // Shared by all the source files. By default, only the "console" sink (std::cout) is defined.
+    // Usage: Logger::addSink(std::make_shared<LoggerUtils::OStreamSink>(std::cerr), "stderr");
+    //        Logger::getSink("stderr")->setMaxLogLevel(Logger::LogLevel::ERROR);
+    inline static void addSink(const std::shared_ptr<LoggerUtils::LogSink>& sink_, const std::string& name_ = ""){ LoggerUtils::getLogSinkDispatcher().addSink(sink_, name_); }
+    inline static void removeSink(const std::string& name_){ LoggerUtils::getLogSinkDispatcher().removeSink(name_); }
+    inline static void clearSinks(){ LoggerUtils::getLogSinkDispatcher().clearSinks(); }
+    inline static std::shared_ptr<LoggerUtils::LogSink> getSink(const std::string& name_){ return LoggerUtils::getLogSinkDispatcher().getSink(name_); }
+
     //! Non-static Methods
     // For printf-style calls
     template <typename... TT> inline void operator()(const char *fmt_str, TT && ... args);
+    // For "{}" formatting calls, type-safe and checked at compile time with C++20. Usage: LogInfo.fmt("read {} events in {:.3f}s", nEvents, time);
+    template<typename... Args> inline void fmt(LoggerUtils::FormatString<typename LoggerUtils::TypeIdentity<Args>::type...> fmtStr_, const Args&... args_);
     // For std::cout-style calls
     template<typename T> inline Logger &operator<<(const T &data);
+    template<typename Iterator> inline Logger &operator<<(const LoggerUtils::RangeView<Iterator>& range_); // LogRange(), formatted in place
+    inline Logger &operator<<(const LoggerUtils::HexView& hexView_); // LogHex(), one line per row
     inline Logger &operator<<(std::ostream &(*f)(std::ostream &));
     inline Logger &operator<<(Logger& l_);
     inline Logger &operator()(bool condition_);
+    // For multi-line outputs (tables, summaries): the lines are gathered, then printed at once when the block is destroyed,
+    // with a single prefix computation and without lines of other threads in between.
+    // Usage: auto block = LogInfo.block(); block << row1 << std::endl; block << row2 << std::endl;
+    class Block;
+    inline Block block();
 
     // Macro-Related Methods
     // Those intended to be called using the above preprocessor macros
-    inline Logger(LogLevel logLevel_, char const * fileName_, int lineNumber_, bool once_=false);
+    inline Logger(LogLevel logLevel_, char const * fileName_, int lineNumber_, bool once_=false, LoggerUtils::LogFilterSite* filterSite_=nullptr);
+    inline ~Logger();
 
-    inline static void throwError(const std::string& errorStr_ = "");
-    inline static void triggerExit(const std::string& errorStr_ = "");
+    [[noreturn]] inline static void throwError(const std::string& errorStr_ = "");
+    [[noreturn]] inline static void triggerExit(const std::string& errorStr_ = "");
+    // cold paths of LogThrowIf/LogAssert, LogExitIf, LogContinueIf and LogReturnIf
+    template<typename MessageFct> [[noreturn]] LOGGER_COLD inline static void throwErrorAt(const LoggerUtils::CallSite& site_, const MessageFct& printMessage_);
+    template<typename MessageFct> [[noreturn]] LOGGER_COLD inline static void triggerExitAt(const LoggerUtils::CallSite& site_, const MessageFct& printMessage_);
+    template<typename MessageFct> LOGGER_COLD inline static void printWarningAt(const LoggerUtils::CallSite& site_, const MessageFct& printMessage_);
 
     // Deprecated (left here for compatibility)
     inline static void setMaxLogLevel(int maxLogLevel_);
@@ -163,16 +274,41 @@ namespace {
 
   protected:
 
+    // Parameters of the print statement: refreshed once by the constructor, so that a setter called meanwhile by another
+    // thread can't mix two snapshots in one line. Lock-free: one load and compare while nothing changes.
+    inline static void refreshStatementConfig();
+    inline static const Config& getStatementConfig();
+
     inline static void buildCurrentPrefix();
     inline static void generateUserHeader(std::string &strBuffer_);
     inline static std::string generateUserHeader(){ std::string out{}; generateUserHeader(out); return out; }
-    inline static std::string getLogLevelColorStr(const LogLevel &selectedLogLevel_);
-    inline static std::string getLogLevelStr(const LogLevel &selectedLogLevel_);
     template<typename ... Args> inline static void printFormat(const char *fmt_str, Args ... args );
 
+    // Records
+    inline static void startCurrentRecordPiece(); // builds the prefix if a new line starts
+    inline static void fillCurrentRecordContext();
+    inline static void dispatchCurrentRecord(char terminator_ = '\0');
+    inline static void printBlock(const std::string& blockStr_, bool isLastLinePending_ = false); // the last line can be ended later by std::endl
+    inline static void printTerminalCommand(const std::string& command_);
+
+    // Statements
+    struct StatementScope{
+      // Member of the Logger declared before its lock, so released after it: the periodic dumps claimed while the thread
+      // held a logger mutex (LogStat or LogScopeTimer in the arguments of a print) are printed once the outermost statement ends
+      inline StatementScope(){ LoggerUtils::getThreadStatementDepth()++; }
+      inline ~StatementScope(){ if( --LoggerUtils::getThreadStatementDepth() == 0 ){ Logger::printPendingDumps(); } }
+    };
+    inline static void printPendingDumps();
+
     // Setup Methods
     inline static void setupStreamBufferSupervisor();
     inline static void setupOutputFile();
+    inline static void setupBinaryOutputFile();
+    inline static std::string buildOutputFilePath(const std::string& nameFormat_);
+
+  public:
+    inline static std::string getLogLevelColorStr(const LogLevel &selectedLogLevel_);
+    inline static std::string getLogLevelStr(const LogLevel &selectedLogLevel_);
 
   private:
 
@@ -180,60 +316,54 @@ namespace {
     // C++17 code
 
     // parameters
-    static inline bool _enableColors_{LOGGER_ENABLE_COLORS};
-    static inline bool _disablePrintfLineJump_{false};
-    static inline bool _propagateColorsOnUserHeader_{LOGGER_ENABLE_COLORS_ON_USER_HEADER};
-    static inline bool _cleanLineBeforePrint_{LOGGER_WRITE_OUTFILE};
-    static inline bool _writeInOutputFile_{false};
-    static inline bool _isMuted_{false};
-    static inline std::string _prefixFormat_{};
-    static inline std::string _indentStr_{};
-    static inline std::stringstream _userHeaderSs_{};
-    static inline LogLevel _maxLogLevel_{static_cast<Logger::LogLevel>(LOGGER_MAX_LOG_LEVEL_PRINTED)};
-    static inline PrefixLevel _prefixLevel_{static_cast<Logger::PrefixLevel>(LOGGER_PREFIX_LEVEL)};
+    static inline LoggerUtils::AtomicSharedPtr<const Config> _config_{std::make_shared<const Config>()}; // published snapshot
+    static inline std::atomic<uint64_t> _configVersion_{1}; // incremented after each publication
+    static inline std::mutex _configMutex_{}; // between setters only: the printing threads never take it
+    static inline thread_local std::shared_ptr<const Config> _threadConfig_{}; // snapshot in use by the thread
+    static inline thread_local uint64_t _threadConfigVersion_{0};
+    static inline thread_local LoggerUtils::IndentState _indentState_{}; // indentation doesn't leak to other threads
 
     // internal
     static inline bool _isNewLine_{true};
     static inline int _currentLineNumber_{-1};
     static inline std::string _currentFileName_{};
     static inline std::string _currentPrefix_{};
-    static inline std::string _outputFileName_{};
     static inline std::mutex _loggerMutex_{};
     static inline std::unordered_set<size_t> _onceLogList_{};
     static inline LogLevel _currentLogLevel_{Logger::LogLevel::TRACE};
+    static inline LogLevel _currentMaxLogLevel_{Logger::LogLevel::TRACE}; // of the current statement: from the config, or set by a filter
     static inline LoggerUtils::StreamBufferSupervisor* _streamBufferSupervisorPtr_{nullptr};
     static inline LoggerUtils::StreamBufferSupervisor _streamBufferSupervisor_;
+    static inline LoggerUtils::LogRecord _currentRecord_{};
 
     // non-static
-    std::scoped_lock<std::mutex> _lock_{_loggerMutex_}; // one logger can be created at a given time
+    StatementScope _statementScope_{};
+    LoggerUtils::StatsLockGuard _lock_{_loggerMutex_, LoggerUtils::StatsTime::LOGGER_LOCK_WAIT, LoggerUtils::StatsTime::LOGGER_LOCK_HELD}; // one logger can be created at a given time
 #else
     // parameters
-    static bool _enableColors_;
-    static bool _disablePrintfLineJump_;
-    static bool _propagateColorsOnUserHeader_;
-    static bool _cleanLineBeforePrint_;
-    static bool _writeInOutputFile_;
-    static bool _isMuted_;
-    static std::string _prefixFormat_;
-    static std::string _indentStr_;
-    static std::stringstream _userHeaderSs_;
-    static LogLevel _maxLogLevel_;
-    static PrefixLevel _prefixLevel_;
+    static LoggerUtils::AtomicSharedPtr<const Config> _config_;
+    static std::atomic<uint64_t> _configVersion_;
+    static std::mutex _configMutex_;
+    static thread_local std::shared_ptr<const Config> _threadConfig_;
+    static thread_local uint64_t _threadConfigVersion_;
+    static thread_local LoggerUtils::IndentState _indentState_; // indentation doesn't leak to other threads
 
     // internal
     static bool _isNewLine_;
     static int _currentLineNumber_;
     static std::string _currentFileName_;
     static std::string _currentPrefix_;
-    static std::string _outputFileName_;
     static std::mutex _loggerMutex_;
     static std::unordered_set<size_t> _onceLogList_;
     static LogLevel _currentLogLevel_;
+    static LogLevel _currentMaxLogLevel_;
     static LoggerUtils::StreamBufferSupervisor* _streamBufferSupervisorPtr_;
     static LoggerUtils::StreamBufferSupervisor _streamBufferSupervisor_;
+    static LoggerUtils::LogRecord _currentRecord_;
 
     // non-static
-    std::lock_guard<std::mutex> _lock_{_loggerMutex_};
+    StatementScope _statementScope_{};
+    LoggerUtils::StatsLockGuard _lock_{_loggerMutex_, LoggerUtils::StatsTime::LOGGER_LOCK_WAIT, LoggerUtils::StatsTime::LOGGER_LOCK_HELD};
 #endif
 
   public:
@@ -241,6 +371,75 @@ namespace {
       inline ScopedIndent(){ LogIndent; }
       inline ~ScopedIndent(){ LogUnIndent; }
     };
+    struct ScopedContext{
+      // shared by all the source files, for the calling thread
+      template<typename T> inline ScopedContext(const char* key_, const T& value_){ LoggerUtils::getContextStack().push(key_, value_); }
+      inline ~ScopedContext(){ LoggerUtils::getContextStack().pop(); }
+      ScopedContext(const ScopedContext&) = delete;
+      ScopedContext& operator=(const ScopedContext&) = delete;
+    };
+    struct ScopedTimer{
+      inline explicit ScopedTimer(const LoggerUtils::TimerSite& site_) : _site_(site_), _startNs_(LoggerUtils::getMonotonicTimeNs()) {}
+      inline ~ScopedTimer();
+      ScopedTimer(const ScopedTimer&) = delete;
+      ScopedTimer& operator=(const ScopedTimer&) = delete;
+    private:
+      const LoggerUtils::TimerSite& _site_;
+      uint64_t _startNs_;
+    };
+    class Block{
+    public:
+      inline Block(LogLevel logLevel_, std::string fileName_, int lineNumber_);
+      inline Block(Block&& other_);
+      inline ~Block(){ this->commit(); }
+      Block(const Block&) = delete;
+      Block& operator=(const Block&) = delete;
+
+      template<typename T> inline Block& operator<<(const T& data_);
+      inline Block& operator<<(const char* str_){ if( _isActive_ ){ _buffer_ += str_; } return *this; }
+      inline Block& operator<<(const std::string& str_){ if( _isActive_ ){ _buffer_ += str_; } return *this; }
+      template<typename Iterator> inline Block& operator<<(const LoggerUtils::RangeView<Iterator>& range_){ if( _isActive_ ){ LoggerUtils::formatRange(_buffer_, range_); } return *this; }
+      inline Block& operator<<(const LoggerUtils::HexView& hexView_);
+      inline Block& operator<<(std::ostream& (*f_)(std::ostream&)); // std::endl ends a line of the block
+      template<typename... Args> inline Block& fmt(LoggerUtils::FormatString<typename LoggerUtils::TypeIdentity<Args>::type...> fmtStr_, const Args&... args_); // one line
+
+      inline void commit(); // prints the lines gathered so far, called by the destructor
+
+    private:
+      LogLevel _logLevel_;
+      std::string _fileName_;
+      int _lineNumber_;
+      bool _isActive_;
+      std::string _buffer_{};
+    };
+    class Progress{
+    public:
+      inline explicit Progress(std::string title_, uint64_t total_ = 0); // total_ = 0 if unknown
+      inline ~Progress(){ this->finish(); }
+      Progress(const Progress&) = delete;
+      Progress& operator=(const Progress&) = delete;
+
+      inline void increment(uint64_t n_ = 1){ _count_.fetch_add(n_, std::memory_order_relaxed); this->update(); }
+      inline void setCount(uint64_t count_){ _count_.store(count_, std::memory_order_relaxed); this->update(); }
+      inline void finish(); // prints the final state, called by the destructor
+
+      inline uint64_t getCount() const { return _count_.load(std::memory_order_relaxed); }
+
+    private:
+      inline void update(){ if( LoggerUtils::getMonotonicTimeNs() >= _nextDrawNs_.load(std::memory_order_relaxed) ){ this->tryDraw(); } }
+      inline void tryDraw();
+      inline void draw(uint64_t nowNs_, bool isFinal_);
+
+      const std::string _title_;
+      const uint64_t _total_;
+      const bool _isTerminal_;
+      const uint64_t _startNs_;
+      const uint64_t _periodNs_;
+      bool _isFinished_{false};
+      std::atomic<uint64_t> _count_{0};
+      std::atomic<uint64_t> _nextDrawNs_{0};
+      std::mutex _drawMutex_{};
+    };
 
   };
 
@@ -251,29 +450,25 @@ namespace {
   // Need to declare even default init variables to avoid warning "has internal linkage but is not defined"
 
   // parameters
-  bool Logger::_enableColors_{LOGGER_ENABLE_COLORS};
-  bool Logger::_propagateColorsOnUserHeader_{LOGGER_ENABLE_COLORS_ON_USER_HEADER};
-  bool Logger::_cleanLineBeforePrint_{LOGGER_WRITE_OUTFILE};
-  bool Logger::_disablePrintfLineJump_{false};
-  bool Logger::_writeInOutputFile_{false};
-  bool Logger::_isMuted_{false};
-  Logger::LogLevel Logger::_maxLogLevel_{static_cast<Logger::LogLevel>(LOGGER_MAX_LOG_LEVEL_PRINTED)};
-  Logger::PrefixLevel Logger::_prefixLevel_{static_cast<Logger::PrefixLevel>(LOGGER_PREFIX_LEVEL)};
-  std::stringstream Logger::_userHeaderSs_{};
-  std::string Logger::_prefixFormat_{};
-  std::string Logger::_indentStr_{};
+  LoggerUtils::AtomicSharedPtr<const Logger::Config> Logger::_config_{std::make_shared<const Logger::Config>()};
+  std::atomic<uint64_t> Logger::_configVersion_{1};
+  std::mutex Logger::_configMutex_{};
+  thread_local std::shared_ptr<const Logger::Config> Logger::_threadConfig_{};
+  thread_local uint64_t Logger::_threadConfigVersion_{0};
+  thread_local LoggerUtils::IndentState Logger::_indentState_{};
 
   // internal
   bool Logger::_isNewLine_{true};
   int Logger::_currentLineNumber_{-1};
   std::string Logger::_currentFileName_{};
   std::string Logger::_currentPrefix_{};
-  std::string Logger::_outputFileName_{};
   std::mutex Logger::_loggerMutex_{};
   LoggerUtils::StreamBufferSupervisor* Logger::_streamBufferSupervisorPtr_{nullptr};
   LoggerUtils::StreamBufferSupervisor Logger::_streamBufferSupervisor_{};
   Logger::LogLevel Logger::_currentLogLevel_{Logger::LogLevel::TRACE};
+  Logger::LogLevel Logger::_currentMaxLogLevel_{Logger::LogLevel::TRACE};
   std::unordered_set<size_t> Logger::_onceLogList_{};
+  LoggerUtils::LogRecord Logger::_currentRecord_{};
 
 
 #endif
@@ -0,0 +1,158 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+// Lightweight front header: same Log macros as Logger.h, but each print statement is a few calls into non-inline code.
+// Only <string> and <ostream> are included, and the Logger statics are not duplicated in every source file.
+//
+// Exactly one source file of the program compiles the implementation:
+//   #define LOGGER_LITE_IMPLEMENTATION
+//   #include "LoggerLite.h"
+// The Logger of this source file prints for all the others: configure it there (LoggerInit, sinks, prefix...).
+// Not available here: .fmt(), LogScopeTimer, LogProgress, LogContext and the Logger:: setters (use Logger.h for those).
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGER_LITE_H
+#define SIMPLE_CPP_LOGGER_LOGGER_LITE_H
+
+#ifdef LOGGER_LITE_IMPLEMENTATION
+#include "Logger.h"
+#endif
+
+#include "implementation/LoggerParameters.h"
+#include "implementation/LoggerMacros.h"
+
+#include <string>
+#include <ostream>
+
+
+namespace LoggerLite{
+
+  class Line{
+    // Gathers one print statement, handed to the Logger by the destructor
+  public:
+    Line(int logLevel_, const char* filePath_, int lineNumber_, bool isPrint_ = true, bool isOnce_ = false);
+    ~Line();
+    Line(const Line&) = delete;
+    Line& operator=(const Line&) = delete;
+
+    Line& operator<<(const char* str_);
+    Line& operator<<(const std::string& str_);
+    Line& operator<<(char value_);
+    Line& operator<<(bool value_);
+    Line& operator<<(short value_);
+    Line& operator<<(unsigned short value_);
+    Line& operator<<(int value_);
+    Line& operator<<(unsigned int value_);
+    Line& operator<<(long value_);
+    Line& operator<<(unsigned long value_);
+    Line& operator<<(long long value_);
+    Line& operator<<(unsigned long long value_);
+    Line& operator<<(float value_);
+    Line& operator<<(double value_);
+    Line& operator<<(const void* ptr_);
+    Line& operator<<(std::ostream& (*f_)(std::ostream&)); // std::endl
+    // any other type printable with std::ostream (one instantiation per type, not per print statement)
+    template<typename T> Line& operator<<(const T& data_){
+      if( _isActive_ ){ this->appendStreamed(&streamValue<T>, &data_); }
+      return *this;
+    }
+
+    void operator()(const char* fmtStr_, ...); // printf-style, ends the line
+    Line& operator()(bool condition_);
+
+  private:
+    template<typename T> static void streamValue(std::ostream& stream_, const void* data_){ stream_ << *static_cast<const T*>(data_); }
+    void appendStreamed(void (*streamFct_)(std::ostream&, const void*), const void* data_);
+
+    friend struct LineAccess; // implementation side
+
+    const char* _filePath_;
+    int _lineNumber_;
+    int _logLevel_;
+    bool _isActive_;
+    bool _isOnce_;
+    std::string _payload_{};
+  };
+
+  // cold paths of LogThrowIf/LogAssert, LogExitIf, LogContinueIf and LogReturnIf
+  [[noreturn]] LOGGER_COLD void throwError(Line& line_, const char* conditionStr_);
+  [[noreturn]] LOGGER_COLD void triggerExit(Line& line_, const char* conditionStr_);
+
+  // applied to the Logger of the implementation file, so to all the print statements of LoggerLite.h
+  void setMaxLogLevel(int maxLogLevel_);
+  int getMaxLogLevel();
+  void setIsMuted(bool isMuted_);
+
+}
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGER_H
+// Logger.h already defines them in the implementation file
+
+#define LogLiteImpl( logLevel_, isPrint_, isOnce_ ) (LoggerLite::Line{logLevel_, __FILE__, __LINE__, isPrint_, isOnce_})
+
+#define LogFatal                (LogLiteImpl( 0, true, false ))
+#define LogError                (LogLiteImpl( 1, true, false ))
+#define LogAlert                (LogLiteImpl( 2, true, false ))
+#define LogWarning              (LogLiteImpl( 3, true, false ))
+#define LogInfo                 (LogLiteImpl( 4, true, false ))
+#define LogDebug                (LogLiteImpl( 5, true, false ))
+#define LogTrace                (LogLiteImpl( 6, true, false ))
+
+// conditional
+#define LogFatalIf(isPrint_)    (LogLiteImpl( 0, isPrint_, false ))
+#define LogErrorIf(isPrint_)    (LogLiteImpl( 1, isPrint_, false ))
+#define LogAlertIf(isPrint_)    (LogLiteImpl( 2, isPrint_, false ))
+#define LogWarningIf(isPrint_)  (LogLiteImpl( 3, isPrint_, false ))
+#define LogInfoIf(isPrint_)     (LogLiteImpl( 4, isPrint_, false ))
+#define LogDebugIf(isPrint_)    (LogLiteImpl( 5, isPrint_, false ))
+#define LogTraceIf(isPrint_)    (LogLiteImpl( 6, isPrint_, false ))
+
+// once
+#define LogFatalOnce            (LogLiteImpl( 0, true, true ))
+#define LogErrorOnce            (LogLiteImpl( 1, true, true ))
+#define LogAlertOnce            (LogLiteImpl( 2, true, true ))
+#define LogWarningOnce          (LogLiteImpl( 3, true, true ))
+#define LogInfoOnce             (LogLiteImpl( 4, true, true ))
+#define LogDebugOnce            (LogLiteImpl( 5, true, true ))
+#define LogTraceOnce            (LogLiteImpl( 6, true, true ))
+
+// To make assertions
+#define LogThrowIf2(isThrowing_, errorMessage_)  if(LOGGER_UNLIKELY(isThrowing_)){ LoggerLite::throwError(LogLiteImpl(1, true, false) << "(" << __PRETTY_FUNCTION__ << "): " << errorMessage_, #isThrowing_ ": " #errorMessage_); }
+#define LogThrowIf1(isThrowing_) LogThrowIf2(isThrowing_, #isThrowing_)
+#define LogThrowIf(...) GET_OVERLOADED_MACRO2(__VA_ARGS__, LogThrowIf2, LogThrowIf1)(__VA_ARGS__)
+#define LogAssert(assertion_, errorMessage_)    LogThrowIf(not (assertion_), errorMessage_)
+#define LogThrow(errorMessage_)                 LogThrowIf(true, errorMessage_)
+
+#if LOGGER_ENABLE_ASSERT_DEBUG
+#define LogAssertDebug(assertion_, errorMessage_) LogAssert(assertion_, errorMessage_)
+#else
+#define LogAssertDebug(assertion_, errorMessage_) do{ (void) sizeof(not (assertion_)); } while(false) // not evaluated
+#endif
+
+// Assertion using std::exit() instead of throw
+#define LogExitIf2(isExit_, errorMessage_)  if(LOGGER_UNLIKELY(isExit_)){ LoggerLite::triggerExit(LogLiteImpl(1, true, false) << "(" << __PRETTY_FUNCTION__ << "): " << errorMessage_, #isExit_ ": " #errorMessage_); }
+#define LogExitIf1(isExit_) LogExitIf2(isExit_, #isExit_)
+#define LogExitIf(...) GET_OVERLOADED_MACRO2(__VA_ARGS__, LogExitIf2, LogExitIf1)(__VA_ARGS__)
+#define LogExit(errorMessage_)                 LogExitIf(true, errorMessage_)
+
+// Within loops
+#define LogContinueIf2(isContinue_, continueMessage_)  if(LOGGER_UNLIKELY(isContinue_)){ LogLiteImpl(3, true, false) << "(" << __PRETTY_FUNCTION__ << "): " << continueMessage_ << std::endl; continue; }
+#define LogContinueIf1(isContinue_)  LogContinueIf2(isContinue_, #isContinue_)
+#define LogContinueIf(...) GET_OVERLOADED_MACRO2(__VA_ARGS__, LogContinueIf2, LogContinueIf1)(__VA_ARGS__)
+
+// Within functions
+#define LogReturnIf3(isReturn_, returnMessage_, returnObj_)  if(LOGGER_UNLIKELY(isReturn_)){ LogLiteImpl(3, true, false) << "(" << __PRETTY_FUNCTION__ << "): " << returnMessage_ << std::endl; return returnObj_; }
+#define LogReturnIf2(isReturn_, returnMessage_)  LogReturnIf3(isReturn_, returnMessage_, )
+#define LogReturnIf1(isReturn_)  LogReturnIf2(isReturn_, (#isReturn_))
+#define LogReturnIf(...) GET_OVERLOADED_MACRO3(__VA_ARGS__, LogReturnIf3, LogReturnIf2, LogReturnIf1)(__VA_ARGS__)
+
+// misc
+#define DEBUG_VAR(myVar) LogDebug << "DEBUG_VAR: " << #myVar << " = " << myVar << std::endl
+
+#endif // SIMPLE_CPP_LOGGER_LOGGER_H
+
+#ifdef LOGGER_LITE_IMPLEMENTATION
+#include "implementation/LoggerLite.impl.h"
+#endif
+
+#endif // SIMPLE_CPP_LOGGER_LOGGER_LITE_H
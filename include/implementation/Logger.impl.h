@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 #include <thread>
+#include <chrono>
 #include <cstdio>
 #include <cstdarg>
 #include <utility>
@@ -40,16 +41,278 @@
 
 namespace {
 
+  // Config
+  inline Logger::Config::Config() :
+      isMuted(false),
+      enableColors(LOGGER_ENABLE_COLORS),
+      propagateColorsOnUserHeader(LOGGER_ENABLE_COLORS_ON_USER_HEADER),
+      cleanLineBeforePrint(LOGGER_CLEAR_LINE_BEFORE_PRINT),
+      disablePrintfLineJump(false),
+      writeInOutputFile(LOGGER_WRITE_OUTFILE),
+      writeInBinaryOutputFile(LOGGER_WRITE_BINARY_OUTFILE),
+      maxLogLevel(static_cast<Logger::LogLevel>(LOGGER_MAX_LOG_LEVEL_PRINTED)),
+      prefixLevel(static_cast<Logger::PrefixLevel>(LOGGER_PREFIX_LEVEL)),
+      prefixFormat(LOGGER_PREFIX_FORMAT),
+      userHeaderStr() {}
+  inline void Logger::refreshStatementConfig(){
+    // the previous snapshot is released once no thread uses it anymore
+    uint64_t version = _configVersion_.load(std::memory_order_acquire);
+    if( LOGGER_UNLIKELY(version != _threadConfigVersion_) ){
+      _threadConfig_ = _config_.load();
+      _threadConfigVersion_ = version;
+    }
+  }
+  inline const Logger::Config& Logger::getStatementConfig(){
+    if( LOGGER_UNLIKELY(_threadConfig_ == nullptr) ) Logger::refreshStatementConfig(); // a line ended by a thread which never printed (clearLine()...)
+    return *_threadConfig_;
+  }
+  template<typename ChangeFct> inline void Logger::updateConfig(const ChangeFct& change_){
+    std::lock_guard<std::mutex> lock(_configMutex_); // two setters called at once: none of the changes is lost
+    std::shared_ptr<Config> config = std::make_shared<Config>(*_config_.load());
+    change_(*config);
+    _config_.store(std::move(config));
+    _configVersion_.fetch_add(1, std::memory_order_release);
+  }
+
   // Setters
   inline void Logger::setMaxLogLevel(const Logger& logger_){
     // _currentLogLevel_ is set by the constructor,
     // so when you provide "LogDebug" as an argument the _currentLogLevel_ is automatically updated
     // Stricto sensu: the argument is just a placeholder for silently updating _currentLogLevel_
-    _maxLogLevel_ = _currentLogLevel_;
+    Logger::setMaxLogLevel(_currentLogLevel_);
   }
   inline void Logger::setMaxLogLevel(){
     // same technique as other, but this time with no arguments
-    _maxLogLevel_ = _currentLogLevel_;
+    Logger::setMaxLogLevel(_currentLogLevel_);
+  }
+  inline void Logger::addIncludeFilter(const std::string& siteSpec_, const LogLevel& maxLogLevel_){
+    int maxLogLevel = std::min(static_cast<int>(maxLogLevel_), static_cast<int>(LogLevel::TRACE));
+    LoggerUtils::getLogFilterRegistry().addRule(LoggerUtils::LogFilterRule::parse(siteSpec_, maxLogLevel));
+  }
+  inline void Logger::addExcludeFilter(const std::string& siteSpec_, const LogLevel& fromLogLevel_){
+    int maxLogLevel = std::min(static_cast<int>(fromLogLevel_), static_cast<int>(LogLevel::INVALID)) - 1; // -1: muted
+    LoggerUtils::getLogFilterRegistry().addRule(LoggerUtils::LogFilterRule::parse(siteSpec_, maxLogLevel));
+  }
+  inline void Logger::setWriteInOutputFile(bool writeInOutputFile_){
+    updateConfig([&](Config& config_){ config_.writeInOutputFile = writeInOutputFile_; });
+    Logger::setupOutputFile();
+  }
+  inline void Logger::setWriteInBinaryOutputFile(bool writeInBinaryOutputFile_){
+    updateConfig([&](Config& config_){ config_.writeInBinaryOutputFile = writeInBinaryOutputFile_; });
+    Logger::setupBinaryOutputFile();
+  }
+  inline void Logger::setWriteInShardFiles(bool writeInShardFiles_){
+    if( writeInShardFiles_ ){ LoggerUtils::getShardFileRegistry().enable(Logger::buildOutputFilePath(LOGGER_SHARD_OUTFILE_NAME_FORMAT)); }
+    else{ LoggerUtils::getShardFileRegistry().disable(); }
+  }
+  inline void Logger::setAsyncConsole(bool isAsync_){
+    auto& dispatcher = LoggerUtils::getLogSinkDispatcher();
+    auto consoleSink = dispatcher.getSink("console");
+    if( consoleSink == nullptr ) return;
+    auto asyncSink = std::dynamic_pointer_cast<LoggerUtils::AsyncSink>(consoleSink);
+    if( isAsync_ and asyncSink == nullptr ){ dispatcher.replaceSink("console", std::make_shared<LoggerUtils::AsyncSink>(consoleSink)); }
+    else if( not isAsync_ and asyncSink != nullptr ){ dispatcher.replaceSink("console", asyncSink->getSink()); } // the backlog is written when released
+  }
+
+  // Timers
+  inline void Logger::dumpTimers(){
+    auto summaryList = LoggerUtils::getTimerRegistry().getSummaries();
+    if( summaryList.empty() ) return;
+
+    int nameWidth{4};
+    for( auto& summary : summaryList ){ nameWidth = std::max(nameWidth, int(summary.name.size())); }
+
+    std::string tableStr;
+    char rowBuffer[256];
+    std::snprintf(rowBuffer, sizeof(rowBuffer), "%-*s %10s %11s %11s %11s %11s",
+                  nameWidth, "name", "count", "mean", "p50", "p99", "max");
+    tableStr += rowBuffer;
+    for( auto& summary : summaryList ){
+      std::snprintf(rowBuffer, sizeof(rowBuffer), "\n%-*s %10llu %11s %11s %11s %11s",
+                    nameWidth, summary.name.c_str(), static_cast<unsigned long long>(summary.count),
+                    LoggerUtils::formatDurationNs(summary.meanNs).c_str(),
+                    LoggerUtils::formatDurationNs(double(summary.p50Ns)).c_str(),
+                    LoggerUtils::formatDurationNs(double(summary.p99Ns)).c_str(),
+                    LoggerUtils::formatDurationNs(double(summary.maxNs)).c_str());
+      tableStr += rowBuffer;
+    }
+
+    LogInfo << "Timers summary:" << std::endl << tableStr << std::endl;
+  }
+  inline Logger::ScopedTimer::~ScopedTimer(){
+    uint64_t nowNs = LoggerUtils::getMonotonicTimeNs();
+    LoggerUtils::getThreadTimerHistogram(_site_).add(nowNs - _startNs_);
+
+    // periodic dump: printed by the first thread leaving a timed scope once the interval elapsed,
+    // or at the end of its print statement if the scope is in the arguments of one (logger mutex held)
+    auto& timerRegistry = LoggerUtils::getTimerRegistry();
+    if( timerRegistry.isDumpDue(nowNs) and timerRegistry.claimDump(nowNs) ){
+      if( LoggerUtils::getThreadStatementDepth() == 0 ){ Logger::dumpTimers(); }
+      else{ timerRegistry.setDumpPending(); }
+    }
+  }
+
+  inline void Logger::dumpMetrics(){
+    double elapsedSeconds{0};
+    auto summaryList = LoggerUtils::getMetricRegistry().closeInterval(elapsedSeconds);
+
+    char buffer[256];
+    for( auto& summary : summaryList ){
+      std::snprintf(buffer, sizeof(buffer), ": %llu values in %.1f s, mean %g, min %g, max %g, last %g",
+                    static_cast<unsigned long long>(summary.count), elapsedSeconds, summary.mean, summary.min, summary.max, summary.last);
+      // one statement per stat, with the prefix of its LogStat call
+      Logger logger{Logger::isMuted() ? LogLevel::INVALID : LogLevel::INFO, summary.fileName.c_str(), summary.lineNumber};
+      logger << summary.name << buffer << std::endl;
+    }
+  }
+  inline void Logger::addStatValue(const LoggerUtils::MetricSite& site_, double value_){
+    uint64_t nowNs = LoggerUtils::getMonotonicTimeNs();
+    auto& metricRegistry = LoggerUtils::getMetricRegistry();
+    LoggerUtils::getThreadMetricAccumulator(site_).add(value_, nowNs, metricRegistry.getInterval());
+
+    // periodic dump: only flagged, the caller might be evaluating the arguments of a print statement (logger mutex held)
+    if( metricRegistry.isDumpDue(nowNs) and metricRegistry.claimDump(nowNs) ) metricRegistry.setDumpPending();
+  }
+  inline void Logger::printPendingDumps(){
+    if( LoggerUtils::getTimerRegistry().claimPendingDump() ) Logger::dumpTimers();
+    if( LoggerUtils::getMetricRegistry().claimPendingDump() ) Logger::dumpMetrics();
+  }
+
+  // Block
+  inline Logger::Block::Block(LogLevel logLevel_, std::string fileName_, int lineNumber_) :
+      _logLevel_(logLevel_),
+      _fileName_(std::move(fileName_)),
+      _lineNumber_(lineNumber_),
+      _isActive_(logLevel_ <= Logger::_currentMaxLogLevel_) {} // built by block(): the runtime filters of the call site apply
+  inline Logger::Block::Block(Block&& other_) :
+      _logLevel_(other_._logLevel_),
+      _fileName_(std::move(other_._fileName_)),
+      _lineNumber_(other_._lineNumber_),
+      _isActive_(other_._isActive_),
+      _buffer_(std::move(other_._buffer_)) {
+    other_._isActive_ = false;
+    other_._buffer_.clear();
+  }
+  template<typename T> inline Logger::Block& Logger::Block::operator<<(const T& data_){
+    if( not _isActive_ ) return *this;
+    std::stringstream dataStream;
+    dataStream << data_;
+    _buffer_ += dataStream.str();
+    return *this;
+  }
+  inline Logger::Block& Logger::Block::operator<<(std::ostream& (*f_)(std::ostream&)){
+    // std::flush and others: nothing is printed before the end of the block
+    if( _isActive_ and f_ == static_cast<std::ostream& (*)(std::ostream&)>(std::endl) ){ _buffer_ += '\n'; }
+    return *this;
+  }
+  inline Logger::Block& Logger::Block::operator<<(const LoggerUtils::HexView& hexView_){
+    if( not _isActive_ ) return *this;
+    if( not _buffer_.empty() and _buffer_.back() != '\n' ){ _buffer_ += '\n'; } // the rows start on their own line
+    LoggerUtils::formatHexDump(_buffer_, hexView_.data, hexView_.size, hexView_.maxBytes);
+    return *this;
+  }
+  template<typename... Args> inline Logger::Block& Logger::Block::fmt(LoggerUtils::FormatString<typename LoggerUtils::TypeIdentity<Args>::type...> fmtStr_, const Args&... args_){
+    if( not _isActive_ ) return *this;
+    const LoggerUtils::FormatArg argList[] = { {nullptr, nullptr}, LoggerUtils::makeFormatArg(args_)... };
+    LoggerUtils::formatTo(_buffer_, fmtStr_.str, fmtStr_.size, argList + 1, sizeof...(Args));
+    if( _buffer_.empty() or _buffer_.back() != '\n' ){ _buffer_ += '\n'; } // as Logger::fmt()
+    return *this;
+  }
+  inline void Logger::Block::commit(){
+    if( _isActive_ and not _buffer_.empty() ){
+      Logger logger{_logLevel_, _fileName_.c_str(), _lineNumber_}; // locks and sets the prefix fields
+      Logger::printBlock(_buffer_);
+    }
+    _buffer_.clear();
+  }
+
+  // Progress
+  inline Logger::Progress::Progress(std::string title_, uint64_t total_) :
+      _title_(std::move(title_)),
+      _total_(total_),
+      _isTerminal_(LoggerUtils::isTerminalOutput()),
+      _startNs_(LoggerUtils::getMonotonicTimeNs()),
+      _periodNs_(static_cast<uint64_t>(1E9 * ( _isTerminal_ ? 1. / LOGGER_PROGRESS_REFRESH_RATE : double(LOGGER_PROGRESS_PLAIN_PERIOD) ))) {
+    // the bar shows up right away, plain lines only once a period elapsed
+    _nextDrawNs_.store(_isTerminal_ ? _startNs_ : _startNs_ + _periodNs_, std::memory_order_relaxed);
+  }
+  inline void Logger::Progress::finish(){
+    std::lock_guard<std::mutex> lock(_drawMutex_);
+    if( _isFinished_ ) return;
+    _isFinished_ = true;
+    _nextDrawNs_.store(UINT64_MAX, std::memory_order_relaxed);
+    this->draw(LoggerUtils::getMonotonicTimeNs(), true);
+  }
+  inline void Logger::Progress::tryDraw(){
+    // workers never wait on each other: the one getting the lock draws for everyone
+    std::unique_lock<std::mutex> lock(_drawMutex_, std::try_to_lock);
+    if( not lock.owns_lock() or _isFinished_ ) return;
+    uint64_t nowNs = LoggerUtils::getMonotonicTimeNs();
+    if( nowNs < _nextDrawNs_.load(std::memory_order_relaxed) ) return; // another thread just drew
+    _nextDrawNs_.store(nowNs + _periodNs_, std::memory_order_relaxed);
+    this->draw(nowNs, false);
+  }
+  inline void Logger::Progress::draw(uint64_t nowNs_, bool isFinal_){
+    uint64_t count = _count_.load(std::memory_order_relaxed);
+    double elapsedTime = double(nowNs_ - _startNs_) / 1E9;
+    double rate = ( elapsedTime > 0 ? double(count) / elapsedTime : 0 );
+
+    auto formatTime = [](double seconds_){
+      auto totalSeconds = static_cast<long long>(seconds_);
+      char buffer[32];
+      if( totalSeconds >= 3600 ){ std::snprintf(buffer, sizeof(buffer), "%lld:%02lld:%02lld", totalSeconds / 3600, (totalSeconds / 60) % 60, totalSeconds % 60); }
+      else{ std::snprintf(buffer, sizeof(buffer), "%02lld:%02lld", totalSeconds / 60, totalSeconds % 60); }
+      return std::string(buffer);
+    };
+
+    char buffer[128];
+    std::string statusStr;
+    if( _total_ != 0 ){
+      double fraction = std::min(1., double(count) / double(_total_));
+      std::snprintf(buffer, sizeof(buffer), " %5.1f%% %llu/%llu", 100. * fraction,
+                    static_cast<unsigned long long>(count), static_cast<unsigned long long>(_total_));
+    }
+    else{
+      std::snprintf(buffer, sizeof(buffer), " %llu", static_cast<unsigned long long>(count));
+    }
+    statusStr += buffer;
+    if( elapsedTime * LOGGER_PROGRESS_REFRESH_RATE >= 1 ){ // too noisy before
+      std::snprintf(buffer, sizeof(buffer), " %.1f/s", rate);
+      statusStr += buffer;
+    }
+    else{ rate = 0; }
+    if( isFinal_ ){ statusStr += " in " + formatTime(elapsedTime); }
+    else if( _total_ != 0 and rate > 0 and count < _total_ ){ statusStr += " ETA " + formatTime(double(_total_ - count) / rate); }
+
+    if( not _isTerminal_ ){
+      LogInfo << _title_ << ":" << statusStr << std::endl;
+      return;
+    }
+
+    std::string barStr;
+    if( _total_ != 0 ){
+      std::string prefixStr;
+      LoggerUtils::stripAnsiEscapeCodes(Logger::getPrefixString(LogInfo), prefixStr);
+      int barWidth = LoggerUtils::getCachedTerminalWidth() - 1
+                     - int(prefixStr.size() + Logger::getIndentStr().size() + _title_.size() + statusStr.size()) - 3;
+      if( barWidth >= 10 ){
+        int nFilled = int(double(barWidth) * std::min(1., double(count) / double(_total_)));
+        barStr.reserve(size_t(barWidth) + 3);
+        barStr += " [";
+        barStr.append(size_t(nFilled), '#');
+        barStr.append(size_t(barWidth - nFilled), ' ');
+        barStr += ']';
+      }
+    }
+
+    if( isFinal_ ){
+      LogInfo << _title_ << barStr << statusStr << std::endl;
+    }
+    else{
+      // the next printed line (bar or not) clears this one first
+      LogInfo << (_title_ + barStr + statusStr + '\r') << std::flush;
+      LoggerUtils::TerminalState::getHasProgressLine().store(true, std::memory_order_relaxed);
+    }
   }
 
   // Getters
@@ -61,7 +324,25 @@ namespace {
     // Calling the constructor will automatically update the fields
     return Logger::getPrefixString();
   }
+  inline std::string Logger::getOutputFilePath(){
+    auto sink = Logger::getSink("outfile");
+    auto fileSink = std::dynamic_pointer_cast<LoggerUtils::FileSink>(sink);
+    if( fileSink != nullptr ) return fileSink->getFilePath();
+    auto compressedFileSink = std::dynamic_pointer_cast<LoggerUtils::CompressedFileSink>(sink);
+    return (compressedFileSink != nullptr ? compressedFileSink->getFilePath() : std::string());
+  }
+  inline std::string Logger::getBinaryOutputFilePath(){
+    auto sink = std::dynamic_pointer_cast<LoggerUtils::BinaryFileSink>(Logger::getSink("binary_outfile"));
+    return (sink != nullptr ? sink->getFilePath() : std::string());
+  }
+
 
+  // Misc
+  inline void Logger::triggerNewLine(){
+    // what has been printed so far goes out now, the next print will start with the prefix
+    if( not _currentRecord_.empty() ) Logger::dispatchCurrentRecord();
+    _isNewLine_ = true;
+  }
 
   // User Methods
   inline void Logger::quietLineJump() {
@@ -74,7 +355,7 @@ namespace {
 
     // VT100 commands
     if( not clearLines_ ){
-      *_streamBufferSupervisorPtr_ << static_cast<char>(27) << "[" << nLines_ << "F";
+      Logger::printTerminalCommand("\x1b[" + std::to_string(nLines_) + "F");
     }
     else{
       for( int iLine = 0 ; iLine < nLines_ ; iLine++ ){
@@ -89,7 +370,7 @@ namespace {
 
     // VT100 commands
     if( not clearLines_ ){
-      *_streamBufferSupervisorPtr_ << static_cast<char>(27) << "[" << nLines_ << ";1E";
+      Logger::printTerminalCommand("\x1b[" + std::to_string(nLines_) + ";1E");
     }
     else{
       for( int iLine = 0 ; iLine < nLines_ ; iLine++ ){
@@ -100,26 +381,28 @@ namespace {
   }
   inline void Logger::clearLine(){
     Logger::setupStreamBufferSupervisor(); // in case it was not
-    *_streamBufferSupervisorPtr_ << static_cast<char>(27) << "[2K" << "\r";
+    Logger::printTerminalCommand("\x1b[2K\r");
   }
   inline void Logger::printNewLine(){
-    *_streamBufferSupervisorPtr_ << std::endl;
-    triggerNewLine();
+    // equivalent of std::endl
+    Logger::dispatchCurrentRecord('\n');
+    if( not LoggerUtils::getShardFileRegistry().isEnabled() ){ LoggerUtils::getLogSinkDispatcher().flush(); }
+    _isNewLine_ = true;
   }
 
   //! Non-static Methods
   // For printf-style calls
   template<typename... TT> inline void Logger::operator()(const char *fmt_str, TT &&... args) {
 
-    if (_currentLogLevel_ > _maxLogLevel_) return;
+    if (_currentLogLevel_ > _currentMaxLogLevel_) return;
 
     Logger::printFormat(fmt_str, std::forward<TT>(args)...);
-    if (not _disablePrintfLineJump_ and fmt_str[strlen(fmt_str) - 1] != '\n') { printNewLine(); }
+    if (not Logger::getStatementConfig().disablePrintfLineJump and fmt_str[strlen(fmt_str) - 1] != '\n') { printNewLine(); }
 
   }
   template<typename T> inline Logger &Logger::operator<<(const T &data) {
 
-    if (_currentLogLevel_ > _maxLogLevel_) return *this;
+    if (_currentLogLevel_ > _currentMaxLogLevel_) return *this;
 
     std::stringstream dataStream;
     dataStream << data;
@@ -133,13 +416,49 @@ namespace {
 
     return *this;
   }
+  template<typename Iterator> inline Logger &Logger::operator<<(const LoggerUtils::RangeView<Iterator>& range_){
+
+    if (_currentLogLevel_ > _currentMaxLogLevel_) return *this;
+
+    // formatted right into the record, no intermediate stream
+    Logger::startCurrentRecordPiece();
+    std::string& payload = _currentRecord_.payload;
+    size_t begin = payload.size();
+    LoggerUtils::formatRange(payload, range_);
+
+    if( payload.find_first_of("\n\r", begin) != std::string::npos ){
+      // line jumps in the elements (rare): the printf path takes care of reprinting the prefix
+      std::string formattedString(payload, begin);
+      payload.resize(begin);
+      Logger::printFormat(formattedString.c_str());
+    }
+
+    return *this;
+  }
+  inline Logger &Logger::operator<<(const LoggerUtils::HexView& hexView_){
+
+    if (_currentLogLevel_ > _currentMaxLogLevel_) return *this;
+
+    // one line per row, each with its prefix
+    std::string dumpStr;
+    LoggerUtils::formatHexDump(dumpStr, hexView_.data, hexView_.size, hexView_.maxBytes);
+    if( not dumpStr.empty() ){ Logger::printBlock(dumpStr, true); }
+
+    return *this;
+  }
   inline Logger &Logger::operator<<(std::ostream &(*f)(std::ostream &)) {
 
     // Handling std::endl
-    if (_currentLogLevel_ > _maxLogLevel_) return *this;
+    if (_currentLogLevel_ > _currentMaxLogLevel_) return *this;
 
-    *_streamBufferSupervisorPtr_ << f;
-    triggerNewLine();
+    if( f == static_cast<std::ostream &(*)(std::ostream &)>(std::endl) ){
+      printNewLine();
+    }
+    else{
+      // std::flush and others
+      triggerNewLine();
+      if( not LoggerUtils::getShardFileRegistry().isEnabled() ){ LoggerUtils::getLogSinkDispatcher().flush(); }
+    }
 
     return *this;
   }
@@ -151,8 +470,12 @@ namespace {
     return *this;
   }
 
+  inline Logger::Block Logger::block(){
+    return Block{_currentLogLevel_, _currentFileName_, _currentLineNumber_};
+  }
+
   // C-tor D-tor
-  inline Logger::Logger(LogLevel logLevel_, char const *fileName_, int lineNumber_, bool once_) {
+  inline Logger::Logger(LogLevel logLevel_, char const *fileName_, int lineNumber_, bool once_, LoggerUtils::LogFilterSite* filterSite_) {
 
     setupStreamBufferSupervisor(); // hook the stream buffer to an object we can handle
     if (logLevel_ != _currentLogLevel_) triggerNewLine(); // force reprinting the prefix if the verbosity has changed
@@ -161,6 +484,14 @@ namespace {
     _currentLogLevel_ = logLevel_;
     _currentFileName_ = fileName_;
     _currentLineNumber_ = lineNumber_;
+    Logger::refreshStatementConfig();
+    _currentMaxLogLevel_ = Logger::getStatementConfig().maxLogLevel;
+
+    if( filterSite_ != nullptr and logLevel_ != LogLevel::INVALID ){
+      int siteMaxLogLevel = LoggerUtils::getSiteMaxLogLevel(*filterSite_, fileName_, lineNumber_);
+      if( siteMaxLogLevel == -1 ){ _currentLogLevel_ = LogLevel::INVALID; } // excluded
+      else if( siteMaxLogLevel != LoggerUtils::LogFilterRegistry::noMatch ){ _currentMaxLogLevel_ = static_cast<LogLevel>(siteMaxLogLevel); }
+    }
 
     if( once_ ){
       size_t instanceHash{(size_t) lineNumber_};
@@ -176,40 +507,79 @@ namespace {
       }
     }
   }
+  inline Logger::~Logger(){
+    // a print statement which doesn't end the line still has to show up now
+    if( not _currentRecord_.empty() ) Logger::dispatchCurrentRecord();
+#if LOGGER_ENABLE_STACK_TRACE
+    if( LOGGER_UNLIKELY(_currentLogLevel_ == LogLevel::FATAL) and _currentLogLevel_ <= _currentMaxLogLevel_ ){
+      // symbolized right away: a fatal print is expected to be among the last ones
+      Logger::printBlock("stack trace:\n" + LoggerUtils::captureStackTrace().toString());
+    }
+#endif
+  }
 
   inline void Logger::throwError(const std::string& errorStr_) {
+    auto stackTrace = LoggerUtils::captureStackTrace(); // addresses only: symbolized if the catcher prints it
     std::stringstream ss;
     ss << "exception thrown by the logger at " << _currentFileName_ << ":" << _currentLineNumber_;
     ss << (errorStr_.empty()? "." : ": " + errorStr_);
     if (Logger::getStreamBufferSupervisorPtr() != nullptr) Logger::getStreamBufferSupervisorPtr()->flush();
-    throw std::runtime_error( ss.str() );
+    LoggerUtils::getLogSinkDispatcher().sync(); // the exception might never be caught
+    LoggerUtils::getShardFileRegistry().flushAll();
+    throw LoggerUtils::TracedRuntimeError( ss.str(), stackTrace );
   }
   inline void Logger::triggerExit( const std::string& errorStr_ ){
+    LoggerUtils::getLogSinkDispatcher().sync();
+    LoggerUtils::getShardFileRegistry().flushAll();
     std::cout << "std::exit() called by the logger at " << _currentFileName_ << ":" << _currentLineNumber_;
     std::cout << (errorStr_.empty()? "." : ": " + errorStr_) << std::endl;
     std::exit( EXIT_FAILURE );
   }
 
+  // no "inline" here: it would conflict with the noinline of LOGGER_COLD (templates don't need it)
+  template<typename MessageFct> void Logger::throwErrorAt(const LoggerUtils::CallSite& site_, const MessageFct& printMessage_){
+    Logger logger{Logger::isMuted() ? LogLevel::INVALID : LogLevel::ERROR, site_.getFileName(), site_.lineNumber};
+    logger << "(" << site_.functionName << "): ";
+    printMessage_(logger);
+    logger << std::endl;
+    Logger::throwError(site_.conditionStr); // the logger is still locked, as with LogError << ... .throwError()
+  }
+  template<typename MessageFct> void Logger::triggerExitAt(const LoggerUtils::CallSite& site_, const MessageFct& printMessage_){
+    Logger logger{Logger::isMuted() ? LogLevel::INVALID : LogLevel::ERROR, site_.getFileName(), site_.lineNumber};
+    logger << "(" << site_.functionName << "): ";
+    printMessage_(logger);
+    logger << std::endl;
+    Logger::triggerExit(site_.conditionStr);
+  }
+  template<typename MessageFct> void Logger::printWarningAt(const LoggerUtils::CallSite& site_, const MessageFct& printMessage_){
+    Logger logger{Logger::isMuted() ? LogLevel::INVALID : LogLevel::WARNING, site_.getFileName(), site_.lineNumber};
+    logger << "(" << site_.functionName << "): ";
+    printMessage_(logger);
+    logger << std::endl;
+  }
+
   // Deprecated (left here for compatibility)
   inline void Logger::setMaxLogLevel(int maxLogLevel_) {
     Logger::setMaxLogLevel(static_cast<Logger::LogLevel>(maxLogLevel_));
   }
   inline void Logger::setMaxLogLevel(const LogLevel &maxLogLevel_) {
-    _maxLogLevel_ = maxLogLevel_;
+    updateConfig([&](Config& config_){ config_.maxLogLevel = maxLogLevel_; });
   }
 
 
   // Protected Methods
   inline void Logger::buildCurrentPrefix() {
 
+    LoggerUtils::StatsTimeScope prefixTime{LoggerUtils::StatsTime::PREFIX};
+    const Config& config = Logger::getStatementConfig(); // the one of the statement: one line never mixes two snapshots
     std::stringstream ssBuffer;
 
     // RESET THE PREFIX
     _currentPrefix_ = "";
 
     // Nothing else -> NONE level
-    if( Logger::_prefixLevel_ == Logger::PrefixLevel::NONE ){
-      if( not _userHeaderSs_.str().empty() ){
+    if( config.prefixLevel == Logger::PrefixLevel::NONE ){
+      if( not config.userHeaderStr.empty() ){
         Logger::generateUserHeader(_currentPrefix_);
         _currentPrefix_ += " "; // extra space
       }
@@ -217,17 +587,17 @@ namespace {
     }
 
     // default:
-    // _prefixFormat_ = "{TIME} {USER_HEADER} {SEVERITY} {FILELINE} {THREAD}";
-    if( _prefixFormat_.empty() ) _prefixFormat_ = LOGGER_PREFIX_FORMAT;
+    // prefixFormat = "{TIME} {USER_HEADER} {SEVERITY} {FILELINE} {THREAD} {CONTEXT}";
+    const std::string& prefixFormat = config.prefixFormat;
 
     // reset the prefix
-    _currentPrefix_ = LoggerUtils::stripStringUnicode(_prefixFormat_); // remove potential colors
+    _currentPrefix_ = LoggerUtils::stripStringUnicode(prefixFormat.empty() ? LOGGER_PREFIX_FORMAT : prefixFormat); // remove potential colors
 
     // {SEVERITY} -> at least MINIMAL level -> LATER, can introduce repeated space in the prefix!
 
     // {TIME} -> at least PRODUCTION level
     ssBuffer.str("");
-    if (Logger::_prefixLevel_ >= Logger::PrefixLevel::PRODUCTION) {
+    if (config.prefixLevel >= Logger::PrefixLevel::PRODUCTION) {
       time_t rawTime = std::time(nullptr);
       struct tm timeInfo = *localtime(&rawTime);
       std::stringstream ss;
@@ -244,33 +614,86 @@ namespace {
 
     // {FILE} and {LINE} -> at least DEBUG level
     ssBuffer.str("");
-    if(Logger::_prefixLevel_ >= Logger::PrefixLevel::DEBUG){
-      ssBuffer << (_enableColors_ ? LOGGER_STR_COLOR_LIGHT_GREY : "");
+    if(config.prefixLevel >= Logger::PrefixLevel::DEBUG){
+      ssBuffer << (config.enableColors ? LOGGER_STR_COLOR_LIGHT_GREY : "");
       ssBuffer << _currentFileName_ << ":" << std::to_string(_currentLineNumber_);
-      ssBuffer << (_enableColors_ ? LOGGER_STR_COLOR_RESET : "");
+      ssBuffer << (config.enableColors ? LOGGER_STR_COLOR_RESET : "");
     }
     LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{FILELINE}", ssBuffer.str());
 
     // {FILENAME} -> at least PRODUCTION level
     ssBuffer.str("");
-    if(Logger::_prefixLevel_ >= Logger::PrefixLevel::PRODUCTION){
-      ssBuffer << (_enableColors_ ? LOGGER_STR_COLOR_LIGHT_GREY : "");
+    if(config.prefixLevel >= Logger::PrefixLevel::PRODUCTION){
+      ssBuffer << (config.enableColors ? LOGGER_STR_COLOR_LIGHT_GREY : "");
       ssBuffer << _currentFileName_.substr(0, _currentFileName_.find_last_of('.'));
-      ssBuffer << (_enableColors_ ? LOGGER_STR_COLOR_RESET : "");
+      ssBuffer << (config.enableColors ? LOGGER_STR_COLOR_RESET : "");
     }
     LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{FILENAME}", ssBuffer.str());
 
-    // "{THREAD}" -> at least FULL level
-    ssBuffer.str("");
-    if(Logger::_prefixLevel_ >= Logger::PrefixLevel::FULL){
-      ssBuffer << (_enableColors_ ? LOGGER_STR_COLOR_LIGHT_GREY : "");
-      ssBuffer << "(thread: " << std::this_thread::get_id() << ")";
-      ssBuffer << (_enableColors_ ? LOGGER_STR_COLOR_RESET : "");
+    // "{THREAD}", "{THREAD_NAME}" and "{TID}" -> at least FULL level
+    if( config.prefixLevel >= Logger::PrefixLevel::FULL ){
+      const auto& threadIdentity = LoggerUtils::getThreadIdentity(); // rendered once per thread
+      auto replaceThreadToken = [&](const char* token_, const char* label_, const std::string& value_){
+        if( _currentPrefix_.find(token_) == std::string::npos ) return;
+        std::string tokenStr;
+        if( not value_.empty() ){
+          if( config.enableColors ) tokenStr += LOGGER_STR_COLOR_LIGHT_GREY;
+          tokenStr += label_;
+          tokenStr += value_;
+          tokenStr += ")";
+          if( config.enableColors ) tokenStr += LOGGER_STR_COLOR_RESET;
+        }
+        LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, token_, tokenStr);
+      };
+      replaceThreadToken("{THREAD}", "(thread: ", threadIdentity.renderedNumber);
+      replaceThreadToken("{THREAD_NAME}", "(", threadIdentity.name);
+      replaceThreadToken("{TID}", "(tid: ", threadIdentity.renderedKernelId);
+    }
+    else{
+      LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{THREAD}", "");
+      LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{THREAD_NAME}", "");
+      LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{TID}", "");
     }
-    LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{THREAD}", ssBuffer.str());
 
+    // "{PID}", "{RSS}" and "{CPU}" -> at least PRODUCTION level, from the cached sampler (no system call on most lines)
+    bool hasResourceToken = ( _currentPrefix_.find("{PID}") != std::string::npos or _currentPrefix_.find("{RSS}") != std::string::npos or _currentPrefix_.find("{CPU}") != std::string::npos );
+    if( hasResourceToken ){
+      LoggerUtils::ResourceSample sample{};
+      bool isPrinted = ( config.prefixLevel >= Logger::PrefixLevel::PRODUCTION );
+      if( isPrinted ) sample = LoggerUtils::getCachedResourceSample();
+      auto replaceResourceToken = [&](const char* token_, const char* label_, const std::string& value_){
+        std::string tokenStr;
+        if( isPrinted ){
+          if( config.enableColors ) tokenStr += LOGGER_STR_COLOR_LIGHT_GREY;
+          tokenStr += label_;
+          tokenStr += value_;
+          tokenStr += ")";
+          if( config.enableColors ) tokenStr += LOGGER_STR_COLOR_RESET;
+        }
+        LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, token_, tokenStr);
+      };
+      char cpuBuffer[32];
+      std::snprintf(cpuBuffer, sizeof(cpuBuffer), "%.1f s", sample.cpuSeconds);
+      replaceResourceToken("{PID}", "(pid: ", std::to_string(sample.pid));
+      replaceResourceToken("{RSS}", "(rss: ", LoggerUtils::formatByteSize(sample.residentBytes));
+      replaceResourceToken("{CPU}", "(cpu: ", cpuBuffer);
+    }
+
+    // "{CONTEXT}" -> at least MINIMAL level
+    if( _currentPrefix_.find("{CONTEXT}") != std::string::npos ){
+      const auto& contextStack = LoggerUtils::getContextStack();
+      std::string contextStr;
+      if( not contextStack.empty() ){
+        if( config.enableColors ) contextStr += LOGGER_STR_COLOR_LIGHT_GREY;
+        contextStr += "[";
+        contextStr += contextStack.getRenderedStr(); // rendered once per context change
+        contextStr += "]";
+        if( config.enableColors ) contextStr += LOGGER_STR_COLOR_RESET;
+      }
+      LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{CONTEXT}", contextStr);
+    }
 
-    if( _userHeaderSs_.str().empty() ){
+    if( config.userHeaderStr.empty() ){
       LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{USER_HEADER}", "");
     }
 
@@ -280,7 +703,7 @@ namespace {
     while(_currentPrefix_[0] == ' ') _currentPrefix_ = _currentPrefix_.substr(1, _currentPrefix_.size());
 
     // "{USER_HEADER}" -> User prefix can have doubled spaces and spaces on the left
-    if( not _userHeaderSs_.str().empty() ){
+    if( not config.userHeaderStr.empty() ){
       ssBuffer.str("");
       ssBuffer << Logger::generateUserHeader();
       LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{USER_HEADER}", ssBuffer.str());
@@ -288,10 +711,10 @@ namespace {
 
     // {SEVERITY} -> at least MINIMAL level
     ssBuffer.str("");
-    if( Logger::_prefixLevel_ >= Logger::PrefixLevel::MINIMAL ) {
-      ssBuffer << (_enableColors_ ? Logger::getLogLevelColorStr(_currentLogLevel_) : "");
+    if( config.prefixLevel >= Logger::PrefixLevel::MINIMAL ) {
+      ssBuffer << (config.enableColors ? Logger::getLogLevelColorStr(_currentLogLevel_) : "");
       ssBuffer << LoggerUtils::padString(getLogLevelStr(_currentLogLevel_), 5);
-      ssBuffer << (_enableColors_ ? LOGGER_STR_COLOR_RESET : "");
+      ssBuffer << (config.enableColors ? LOGGER_STR_COLOR_RESET : "");
     }
     LoggerUtils::replaceSubstringInsideInputString(_currentPrefix_, "{SEVERITY}", ssBuffer.str());
 
@@ -304,10 +727,11 @@ namespace {
     }
   }
   inline void Logger::generateUserHeader(std::string &strBuffer_) {
-    if( not _userHeaderSs_.str().empty() ){
-      if(_enableColors_ and _propagateColorsOnUserHeader_) strBuffer_ += getLogLevelColorStr(_currentLogLevel_);
-      strBuffer_ += _userHeaderSs_.str();
-      if(_enableColors_ and _propagateColorsOnUserHeader_) strBuffer_ += LOGGER_STR_COLOR_RESET;
+    const Config& config = Logger::getStatementConfig();
+    if( not config.userHeaderStr.empty() ){
+      if(config.enableColors and config.propagateColorsOnUserHeader) strBuffer_ += getLogLevelColorStr(_currentLogLevel_);
+      strBuffer_ += config.userHeaderStr;
+      if(config.enableColors and config.propagateColorsOnUserHeader) strBuffer_ += LOGGER_STR_COLOR_RESET;
     }
   }
   inline std::string Logger::getLogLevelColorStr(const LogLevel &selectedLogLevel_) {
@@ -391,55 +815,178 @@ namespace {
 
         // let the last trail back be handled by the user (or the parent function)
         if (iLine != (slicedString.size() - 1)) {
-          *_streamBufferSupervisorPtr_ << "\r";
+          Logger::dispatchCurrentRecord('\r');
         }
 
       } // for each line
     }
     else{
+      Logger::startCurrentRecordPiece();
+      _currentRecord_.payload += formattedString;
+    } // else multiline
 
-      // If '\r' is detected, trigger Newline to reprint the header
-      if(  _streamBufferSupervisorPtr_->getLastChar() == '\r'
-        or _streamBufferSupervisorPtr_->getLastChar() == '\n'
-      ){
-        triggerNewLine();
-      }
+  }
+  template<typename... Args> inline void Logger::fmt(LoggerUtils::FormatString<typename LoggerUtils::TypeIdentity<Args>::type...> fmtStr_, const Args&... args_){
 
-      // Start printing
-      if(_isNewLine_){
-        if( _cleanLineBeforePrint_ ){ Logger::clearLine(); }
-        Logger::buildCurrentPrefix();
-        *_streamBufferSupervisorPtr_ << _currentPrefix_ << _indentStr_;
-        _isNewLine_ = false;
-      }
+    if (_currentLogLevel_ > _currentMaxLogLevel_) return;
 
-      if (_enableColors_ and _currentLogLevel_ == LogLevel::FATAL){
-        *_streamBufferSupervisorPtr_ << LoggerUtils::formatString("%s", getLogLevelColorStr(LogLevel::FATAL).c_str());
-      }
+    // the first entry is a placeholder: no zero-sized array
+    const LoggerUtils::FormatArg argList[] = { {nullptr, nullptr}, LoggerUtils::makeFormatArg(args_)... };
 
-      *_streamBufferSupervisorPtr_ << formattedString;
+    // formatted right into the record
+    Logger::startCurrentRecordPiece();
+    std::string& payload = _currentRecord_.payload;
+    size_t begin = payload.size();
+    LoggerUtils::formatTo(payload, fmtStr_.str, fmtStr_.size, argList + 1, sizeof...(Args));
 
-      if (_enableColors_ and _currentLogLevel_ == LogLevel::FATAL)
-        *_streamBufferSupervisorPtr_ << LoggerUtils::formatString( LOGGER_STR_COLOR_RESET );
-    } // else multiline
+    if( payload.find_first_of("\n\r", begin) != std::string::npos ){
+      // line jumps (rare): the printf path takes care of reprinting the prefix
+      std::string formattedString(payload, begin);
+      payload.resize(begin);
+      Logger::printFormat(formattedString.c_str());
+    }
 
+    if( not Logger::getStatementConfig().disablePrintfLineJump and (fmtStr_.size == 0 or fmtStr_.str[fmtStr_.size - 1] != '\n') ){ printNewLine(); }
+  }
+
+  // Records
+  inline void Logger::startCurrentRecordPiece(){
+
+    // If '\r' is detected (printed outside the logger), trigger Newline to reprint the header
+    if( _currentRecord_.empty() and
+        (  _streamBufferSupervisorPtr_->getLastChar() == '\r'
+        or _streamBufferSupervisorPtr_->getLastChar() == '\n' )
+    ){
+      triggerNewLine();
+    }
+
+    // Start printing
+    if(_isNewLine_){
+      if( Logger::getStatementConfig().cleanLineBeforePrint or LoggerUtils::TerminalState::consumeProgressLine() ){ Logger::clearLine(); }
+      Logger::buildCurrentPrefix();
+      Logger::fillCurrentRecordContext();
+      // colored and plain variants are rendered once for all the sinks
+      _currentRecord_.coloredPrefix = _currentPrefix_;
+      _currentRecord_.coloredPrefix += Logger::getIndentStr();
+      if( Logger::getStatementConfig().enableColors ){ LoggerUtils::stripAnsiEscapeCodes(_currentPrefix_, _currentRecord_.plainPrefix); }
+      else{ _currentRecord_.plainPrefix = _currentPrefix_; }
+      _currentRecord_.plainPrefix += Logger::getIndentStr();
+      _currentRecord_.isLineStart = true;
+      _isNewLine_ = false;
+    }
+    else if( _currentRecord_.empty() ){
+      // continuing a line started by a previous print statement
+      Logger::fillCurrentRecordContext();
+    }
+  }
+  inline void Logger::fillCurrentRecordContext(){
+    _currentRecord_.logLevel = static_cast<int>(_currentLogLevel_);
+    _currentRecord_.fileName = _currentFileName_;
+    _currentRecord_.lineNumber = _currentLineNumber_;
+    const auto& threadIdentity = LoggerUtils::getThreadIdentity();
+    _currentRecord_.threadId = threadIdentity.number;
+    _currentRecord_.threadSlot = threadIdentity.slot;
+    _currentRecord_.timestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count()
+    );
+    _currentRecord_.enableColors = Logger::getStatementConfig().enableColors;
+    _currentRecord_.payloadColor = ( _currentLogLevel_ == LogLevel::FATAL ? LOGGER_STR_COLOR_RED_BG : nullptr );
+  }
+  inline void Logger::dispatchCurrentRecord(char terminator_){
+    if( _currentRecord_.empty() ) Logger::fillCurrentRecordContext(); // lonely line jump
+    _currentRecord_.terminator = terminator_;
+    if( LoggerUtils::getShardFileRegistry().isEnabled() ){
+      // the shard of the calling thread replaces the sinks: nothing shared with the other threads
+      if( LOGGER_ENABLE_STATS ){ LoggerUtils::getThreadStats().addRecord(_currentRecord_.logLevel, _currentRecord_.payload.size()); }
+      LoggerUtils::getThreadShardFileWriter().write(_currentRecord_);
+    }
+    else{ LoggerUtils::getLogSinkDispatcher().dispatch(_currentRecord_); }
+    _currentRecord_.clear();
+  }
+  inline void Logger::printBlock(const std::string& blockStr_, bool isLastLinePending_){
+    // a line left unfinished by a previous print statement is ended: the block starts on its own line
+    if( not _isNewLine_ ){ Logger::printNewLine(); }
+
+    // the prefix is built once, then copied in the record of each line
+    Logger::startCurrentRecordPiece();
+    std::vector<LoggerUtils::LogRecord> recordList;
+    bool hasPendingLine{false};
+    size_t begin{0};
+    while( begin < blockStr_.size() ){
+      size_t end = blockStr_.find('\n', begin);
+      if( end == std::string::npos ){
+        end = blockStr_.size();
+        if( isLastLinePending_ ){
+          // stays in the current record, ended by the next std::endl as any print statement
+          _currentRecord_.payload.assign(blockStr_, begin, end - begin);
+          hasPendingLine = true;
+          break;
+        }
+      }
+      recordList.emplace_back(_currentRecord_);
+      recordList.back().payload.assign(blockStr_, begin, end - begin);
+      recordList.back().terminator = '\n';
+      begin = end + 1;
+    }
+    if( not hasPendingLine ){
+      _currentRecord_.clear();
+      _isNewLine_ = true;
+    }
+    if( recordList.empty() ) return;
+
+    if( LoggerUtils::getShardFileRegistry().isEnabled() ){
+      for( auto& record : recordList ){
+        if( LOGGER_ENABLE_STATS ){ LoggerUtils::getThreadStats().addRecord(record.logLevel, record.payload.size()); }
+        LoggerUtils::getThreadShardFileWriter().write(record);
+      }
+      return;
+    }
+    LoggerUtils::getLogSinkDispatcher().dispatchBlock(recordList);
+    LoggerUtils::getLogSinkDispatcher().flush();
+  }
+  inline void Logger::printTerminalCommand(const std::string& command_){
+    // keep the ordering with what has already been printed
+    if( not _currentRecord_.empty() ) Logger::dispatchCurrentRecord();
+    LoggerUtils::getLogSinkDispatcher().dispatchTerminalCommand(command_);
   }
 
   // Setup Methods
   inline void Logger::setupStreamBufferSupervisor(){
     if(_streamBufferSupervisorPtr_ != nullptr) return;
     _streamBufferSupervisorPtr_ = new LoggerUtils::StreamBufferSupervisor(); // this object can't be deleted -> that's why we can't directly override with the logger class
+    if( LOGGER_ASYNC_CONSOLE ){ Logger::setAsyncConsole(true); }
+    if( LOGGER_WRITE_SHARD_OUTFILES ){ Logger::setWriteInShardFiles(true); }
     Logger::setupOutputFile();
-
+    Logger::setupBinaryOutputFile();
   }
   inline void Logger::setupOutputFile(){
-    if( not _writeInOutputFile_ or not _outputFileName_.empty() ){
-      return;
-    }
-    _outputFileName_ = LOGGER_OUTFILE_FOLDER;
-    _outputFileName_ += "/";
-    _outputFileName_ += LOGGER_OUTFILE_NAME_FORMAT;
-    LoggerUtils::replaceSubstringInsideInputString(_outputFileName_, "{EXE}", LoggerUtils::getExecutableName());
+    // the output files are shared by all the source files: only the first one to request it opens it
+    if( not Logger::getConfig()->writeInOutputFile ){ return; }
+    LoggerUtils::getLogSinkDispatcher().getOrAddSink("outfile", []() -> std::shared_ptr<LoggerUtils::LogSink> {
+      auto codec = static_cast<LoggerUtils::StreamCodec>(LOGGER_OUTFILE_COMPRESSION);
+      if( codec == LoggerUtils::StreamCodec::NONE ){
+        return std::make_shared<LoggerUtils::FileSink>(Logger::buildOutputFilePath(LOGGER_OUTFILE_NAME_FORMAT));
+      }
+      // the extension reflects the codec: "job.log" -> "job.log.gz"
+      std::string filePath{Logger::buildOutputFilePath(LOGGER_OUTFILE_NAME_FORMAT)};
+      std::string extension{LoggerUtils::getStreamCodecExtension(codec)};
+      if( filePath.size() < extension.size() or filePath.compare(filePath.size() - extension.size(), extension.size(), extension) != 0 ){
+        filePath += extension;
+      }
+      return std::make_shared<LoggerUtils::CompressedFileSink>(filePath, codec);
+    });
+  }
+  inline void Logger::setupBinaryOutputFile(){
+    if( not Logger::getConfig()->writeInBinaryOutputFile ){ return; }
+    LoggerUtils::getLogSinkDispatcher().getOrAddSink("binary_outfile", []{
+      return std::make_shared<LoggerUtils::BinaryFileSink>(Logger::buildOutputFilePath(LOGGER_BINARY_OUTFILE_NAME_FORMAT));
+    });
+  }
+  inline std::string Logger::buildOutputFilePath(const std::string& nameFormat_){
+    std::string outputFilePath{LOGGER_OUTFILE_FOLDER};
+    outputFilePath += "/";
+    outputFilePath += nameFormat_;
+    LoggerUtils::replaceSubstringInsideInputString(outputFilePath, "{EXE}", LoggerUtils::getExecutableName());
     time_t rawTime = std::time(nullptr);
     struct tm timeInfo = *localtime(&rawTime);
     std::stringstream ss;
@@ -450,8 +997,8 @@ namespace {
 #else
     ss << std::put_time(&timeInfo, "%Y%m%d_%H%M%S");
 #endif
-    LoggerUtils::replaceSubstringInsideInputString(_outputFileName_, "{TIME}", ss.str());
-    _streamBufferSupervisorPtr_->openOutFileStream(_outputFileName_);
+    LoggerUtils::replaceSubstringInsideInputString(outputFilePath, "{TIME}", ss.str());
+    return outputFilePath;
   }
 
   // Private Members
@@ -0,0 +1,143 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+#include "LoggerTimers.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <unordered_map>
+
+
+// Binary log layout (integers are written with the host endianness):
+//  - <name>.blog       : file header, then a sequence of [block header + (compressed) block of records]
+//  - <name>.blog.idx   : index header, then one fixed size entry per block (sparse time/level index)
+//  - <name>.blog.sites : text table "id<TAB>line<TAB>file" of the call sites referenced by the records
+namespace LoggerUtils{
+
+  enum class BinaryLogCodec : uint32_t {
+    NONE = 0,
+    ZLIB = 1
+  };
+
+  struct BinaryLogFileHeader{
+    char magic[8];
+    uint32_t version;
+    uint32_t codec;
+  };
+  struct BinaryLogBlockHeader{
+    uint32_t magic;
+    uint32_t codec;
+    uint32_t rawSize;
+    uint32_t storedSize;
+    uint32_t nRecords;
+    uint32_t levelMask;     // bit i set if the block contains at least one record of level i
+    uint64_t minTimestamp;  // ns since epoch
+    uint64_t maxTimestamp;
+  };
+  struct BinaryLogRecordHeader{
+    uint64_t timestamp;     // ns since epoch
+    uint32_t callSiteId;
+    uint32_t threadId;
+    uint32_t length;        // payload size in bytes
+    uint8_t level;
+    uint8_t reserved[3];
+  };
+  struct BinaryLogIndexEntry{
+    uint64_t blockOffset;
+    uint64_t minTimestamp;
+    uint64_t maxTimestamp;  // running max over all the blocks up to this one -> sorted, can be bisected
+    uint32_t levelMask;
+    uint32_t nRecords;
+  };
+
+  class BinaryLogWriter{
+    // Records are appended into an in-memory block which is compressed and written once full.
+    // One index entry is written per block so readers can seek without decompressing the data.
+  public:
+    BinaryLogWriter() = default;
+    BinaryLogWriter(const BinaryLogWriter&) = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+    ~BinaryLogWriter(){ close(); }
+
+    inline bool open(const std::string& filePath_, uint32_t blockSize_ = LOGGER_BINARY_BLOCK_SIZE);
+    inline void close();
+    inline void flush(); // write the pending block -> the file is readable up to this point
+    inline void flushOlderThan(uint64_t ageNs_); // same, if the pending block was started more than ageNs_ ago
+
+    inline void writeRecord(int logLevel_, const std::string& fileName_, int lineNumber_, uint32_t threadId_,
+                            uint64_t timestamp_, const char* data_, size_t size_);
+
+    bool isOpen() const { return _dataStream_.is_open(); }
+    const std::string& getFilePath() const { return _filePath_; }
+
+  private:
+    inline uint32_t getCallSiteId(const std::string& fileName_, int lineNumber_);
+    inline void writeBlock();
+
+    std::mutex _mutex_{};
+    std::string _filePath_{};
+    std::ofstream _dataStream_{};
+    std::ofstream _indexStream_{};
+    std::ofstream _sitesStream_{};
+
+    uint32_t _blockSize_{LOGGER_BINARY_BLOCK_SIZE};
+    std::string _blockBuffer_{};
+    std::string _compressedBuffer_{};
+    BinaryLogBlockHeader _blockHeader_{};
+    uint64_t _blockStartNs_{0}; // monotonic
+    uint64_t _runningMaxTimestamp_{0};
+
+    std::string _callSiteKeyBuffer_{};
+    std::unordered_map<std::string, uint32_t> _callSiteIdMap_{};
+  };
+
+  class BinaryLogReader{
+  public:
+    struct Record{
+      uint64_t timestamp{0};
+      int logLevel{0};
+      uint32_t threadId{0};
+      int lineNumber{0};
+      const std::string* fileName{nullptr};
+      const char* data{nullptr};
+      size_t size{0};
+    };
+
+    inline bool open(const std::string& filePath_);
+
+    // Calls func_ for each record with timestamp in [from_, to_] and level <= maxLogLevel_.
+    // Only the blocks selected by the index are read and decompressed.
+    inline void readRecords(uint64_t from_, uint64_t to_, int maxLogLevel_, const std::function<void(const Record&)>& func_);
+    inline uint64_t getFirstTimestamp();
+
+  private:
+    inline size_t getNbIndexEntries();
+    inline bool readIndexEntry(size_t iEntry_, BinaryLogIndexEntry& entry_);
+    inline void buildIndexFromData(); // fallback if the .idx file is missing or truncated
+    inline bool readBlock(uint64_t offset_, BinaryLogBlockHeader& header_, std::string& rawBuffer_);
+
+    std::string _filePath_{};
+    std::ifstream _dataStream_{};
+    std::ifstream _indexStream_{};
+    std::vector<BinaryLogIndexEntry> _rebuiltIndex_{};
+    bool _useRebuiltIndex_{false};
+    std::unordered_map<uint32_t, std::pair<std::string, int>> _callSites_{};
+    std::string _storedBuffer_{};
+  };
+
+  // Block codec
+  inline bool compressBlock(BinaryLogCodec codec_, const std::string& input_, std::string& output_);
+  inline bool decompressBlock(BinaryLogCodec codec_, const char* input_, size_t inputSize_, size_t rawSize_, std::string& output_);
+
+}
+
+#include "LoggerBinaryFormat.impl.h"
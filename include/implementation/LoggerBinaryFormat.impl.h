@@ -0,0 +1,329 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERBINARYFORMAT_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERBINARYFORMAT_IMPL_H
+
+#include <limits>
+#include <cstring>
+#include <sstream>
+
+#if LOGGER_ENABLE_ZLIB
+#include <zlib.h>
+#endif
+
+
+namespace LoggerUtils{
+
+  namespace BinaryLogConstants{
+    static const char fileMagic[8] = {'S','C','L','B','L','O','G','1'};
+    static const char indexMagic[8] = {'S','C','L','B','I','D','X','1'};
+    static const uint32_t blockMagic = 0x4B4C4253; // "SBLK"
+    static const uint32_t version = 1;
+  }
+
+  // Writer
+  inline bool BinaryLogWriter::open(const std::string& filePath_, uint32_t blockSize_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( _dataStream_.is_open() ) return true;
+
+    _filePath_ = filePath_;
+    _blockSize_ = blockSize_;
+    _dataStream_.open(_filePath_, std::ios::binary | std::ios::trunc);
+    _indexStream_.open(_filePath_ + ".idx", std::ios::binary | std::ios::trunc);
+    _sitesStream_.open(_filePath_ + ".sites", std::ios::trunc);
+    if( not _dataStream_.is_open() or not _indexStream_.is_open() or not _sitesStream_.is_open() ){
+      _dataStream_.close(); _indexStream_.close(); _sitesStream_.close();
+      return false;
+    }
+
+    BinaryLogFileHeader fileHeader{};
+    std::memcpy(fileHeader.magic, BinaryLogConstants::fileMagic, sizeof(fileHeader.magic));
+    fileHeader.version = BinaryLogConstants::version;
+    fileHeader.codec = static_cast<uint32_t>(LOGGER_ENABLE_ZLIB ? BinaryLogCodec::ZLIB : BinaryLogCodec::NONE);
+    _dataStream_.write(reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader));
+    _indexStream_.write(BinaryLogConstants::indexMagic, sizeof(BinaryLogConstants::indexMagic));
+
+    _blockBuffer_.reserve(_blockSize_ + sizeof(BinaryLogRecordHeader));
+    _blockHeader_ = BinaryLogBlockHeader{};
+    return true;
+  }
+  inline void BinaryLogWriter::close(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( not _dataStream_.is_open() ) return;
+    this->writeBlock();
+    _dataStream_.close();
+    _indexStream_.close();
+    _sitesStream_.close();
+  }
+  inline void BinaryLogWriter::flush(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( not _dataStream_.is_open() ) return;
+    this->writeBlock();
+    _sitesStream_.flush();
+    _dataStream_.flush();
+    _indexStream_.flush();
+  }
+  inline void BinaryLogWriter::flushOlderThan(uint64_t ageNs_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( not _dataStream_.is_open() or _blockHeader_.nRecords == 0 ) return;
+    if( getMonotonicTimeNs() - _blockStartNs_ < ageNs_ ) return;
+    this->writeBlock();
+  }
+  inline void BinaryLogWriter::writeRecord(int logLevel_, const std::string& fileName_, int lineNumber_, uint32_t threadId_,
+                                           uint64_t timestamp_, const char* data_, size_t size_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( not _dataStream_.is_open() ) return;
+
+    if( size_ > std::numeric_limits<uint32_t>::max() ) size_ = std::numeric_limits<uint32_t>::max();
+    if( _blockHeader_.nRecords == 0 ) _blockStartNs_ = getMonotonicTimeNs();
+
+    BinaryLogRecordHeader recordHeader{};
+    recordHeader.timestamp = timestamp_;
+    recordHeader.callSiteId = this->getCallSiteId(fileName_, lineNumber_);
+    recordHeader.threadId = threadId_;
+    recordHeader.length = static_cast<uint32_t>(size_);
+    recordHeader.level = static_cast<uint8_t>(logLevel_);
+
+    _blockBuffer_.append(reinterpret_cast<const char*>(&recordHeader), sizeof(recordHeader));
+    _blockBuffer_.append(data_, size_);
+
+    if( _blockHeader_.nRecords == 0 or timestamp_ < _blockHeader_.minTimestamp ) _blockHeader_.minTimestamp = timestamp_;
+    if( timestamp_ > _blockHeader_.maxTimestamp ) _blockHeader_.maxTimestamp = timestamp_;
+    _blockHeader_.levelMask |= (1u << (logLevel_ & 0x1F));
+    _blockHeader_.nRecords++;
+
+    if( _blockBuffer_.size() >= _blockSize_ ) this->writeBlock();
+  }
+  inline uint32_t BinaryLogWriter::getCallSiteId(const std::string& fileName_, int lineNumber_){
+    _callSiteKeyBuffer_ = fileName_;
+    _callSiteKeyBuffer_ += ':';
+    _callSiteKeyBuffer_ += std::to_string(lineNumber_);
+
+    auto it = _callSiteIdMap_.find(_callSiteKeyBuffer_);
+    if( it != _callSiteIdMap_.end() ) return it->second;
+
+    auto newId = static_cast<uint32_t>(_callSiteIdMap_.size());
+    _callSiteIdMap_.emplace(_callSiteKeyBuffer_, newId);
+    // the site table has to be on disk before any block referencing it
+    _sitesStream_ << newId << '\t' << lineNumber_ << '\t' << fileName_ << '\n';
+    return newId;
+  }
+  inline void BinaryLogWriter::writeBlock(){
+    if( _blockHeader_.nRecords == 0 ) return;
+
+    _sitesStream_.flush();
+
+    auto codec = static_cast<BinaryLogCodec>(LOGGER_ENABLE_ZLIB ? BinaryLogCodec::ZLIB : BinaryLogCodec::NONE);
+    const std::string* storedPtr{&_blockBuffer_};
+    if( codec != BinaryLogCodec::NONE ){
+      if( compressBlock(codec, _blockBuffer_, _compressedBuffer_) and _compressedBuffer_.size() < _blockBuffer_.size() ){
+        storedPtr = &_compressedBuffer_;
+      }
+      else{
+        codec = BinaryLogCodec::NONE; // incompressible -> stored as is
+      }
+    }
+
+    _blockHeader_.magic = BinaryLogConstants::blockMagic;
+    _blockHeader_.codec = static_cast<uint32_t>(codec);
+    _blockHeader_.rawSize = static_cast<uint32_t>(_blockBuffer_.size());
+    _blockHeader_.storedSize = static_cast<uint32_t>(storedPtr->size());
+
+    BinaryLogIndexEntry indexEntry{};
+    indexEntry.blockOffset = static_cast<uint64_t>(_dataStream_.tellp());
+    indexEntry.minTimestamp = _blockHeader_.minTimestamp;
+    _runningMaxTimestamp_ = std::max(_runningMaxTimestamp_, _blockHeader_.maxTimestamp);
+    indexEntry.maxTimestamp = _runningMaxTimestamp_;
+    indexEntry.levelMask = _blockHeader_.levelMask;
+    indexEntry.nRecords = _blockHeader_.nRecords;
+
+    _dataStream_.write(reinterpret_cast<const char*>(&_blockHeader_), sizeof(_blockHeader_));
+    _dataStream_.write(storedPtr->data(), static_cast<std::streamsize>(storedPtr->size()));
+    _dataStream_.flush();
+    // index entry written once the block is on disk -> never points to a partial block
+    _indexStream_.write(reinterpret_cast<const char*>(&indexEntry), sizeof(indexEntry));
+    _indexStream_.flush();
+
+    _blockBuffer_.clear();
+    _blockHeader_ = BinaryLogBlockHeader{};
+  }
+
+  // Reader
+  inline bool BinaryLogReader::open(const std::string& filePath_){
+    _filePath_ = filePath_;
+    _dataStream_.open(_filePath_, std::ios::binary);
+    if( not _dataStream_.is_open() ) return false;
+
+    BinaryLogFileHeader fileHeader{};
+    _dataStream_.read(reinterpret_cast<char*>(&fileHeader), sizeof(fileHeader));
+    if( not _dataStream_ or std::memcmp(fileHeader.magic, BinaryLogConstants::fileMagic, sizeof(fileHeader.magic)) != 0 ){
+      return false;
+    }
+
+    std::ifstream sitesStream(_filePath_ + ".sites");
+    std::string line;
+    while( std::getline(sitesStream, line) ){
+      auto firstTab = line.find('\t');
+      auto secondTab = line.find('\t', firstTab + 1);
+      if( firstTab == std::string::npos or secondTab == std::string::npos ) continue;
+      auto id = static_cast<uint32_t>(std::stoul(line.substr(0, firstTab)));
+      _callSites_[id] = std::make_pair(line.substr(secondTab + 1), std::stoi(line.substr(firstTab + 1, secondTab - firstTab - 1)));
+    }
+
+    _indexStream_.open(_filePath_ + ".idx", std::ios::binary);
+    char indexMagic[8]{};
+    if( _indexStream_.is_open() ) _indexStream_.read(indexMagic, sizeof(indexMagic));
+    if( not _indexStream_ or std::memcmp(indexMagic, BinaryLogConstants::indexMagic, sizeof(indexMagic)) != 0 ){
+      this->buildIndexFromData();
+    }
+    return true;
+  }
+  inline void BinaryLogReader::readRecords(uint64_t from_, uint64_t to_, int maxLogLevel_, const std::function<void(const Record&)>& func_){
+    uint32_t acceptedLevelMask{0};
+    for( int iLevel = 0 ; iLevel <= maxLogLevel_ and iLevel < 32 ; iLevel++ ){ acceptedLevelMask |= (1u << iLevel); }
+
+    // bisect the first block whose running max timestamp reaches from_
+    size_t nEntries = this->getNbIndexEntries();
+    size_t lowBound{0}, highBound{nEntries};
+    BinaryLogIndexEntry entry{};
+    while( lowBound < highBound ){
+      size_t middle = lowBound + (highBound - lowBound) / 2;
+      if( not this->readIndexEntry(middle, entry) ) return;
+      if( entry.maxTimestamp < from_ ) lowBound = middle + 1;
+      else highBound = middle;
+    }
+
+    Record record;
+    BinaryLogBlockHeader blockHeader{};
+    std::string rawBuffer;
+    for( size_t iEntry = lowBound ; iEntry < nEntries ; iEntry++ ){
+      if( not this->readIndexEntry(iEntry, entry) ) return;
+      if( entry.minTimestamp > to_ ) break;
+      if( (entry.levelMask & acceptedLevelMask) == 0 ) continue;
+      if( not this->readBlock(entry.blockOffset, blockHeader, rawBuffer) ) return;
+
+      size_t offset{0};
+      BinaryLogRecordHeader recordHeader{};
+      while( offset + sizeof(recordHeader) <= rawBuffer.size() ){
+        std::memcpy(&recordHeader, rawBuffer.data() + offset, sizeof(recordHeader));
+        offset += sizeof(recordHeader);
+        if( offset + recordHeader.length > rawBuffer.size() ) break;
+
+        if( recordHeader.timestamp >= from_ and recordHeader.timestamp <= to_ and recordHeader.level <= maxLogLevel_ ){
+          record.timestamp = recordHeader.timestamp;
+          record.logLevel = recordHeader.level;
+          record.threadId = recordHeader.threadId;
+          auto site = _callSites_.find(recordHeader.callSiteId);
+          record.fileName = (site != _callSites_.end() ? &site->second.first : nullptr);
+          record.lineNumber = (site != _callSites_.end() ? site->second.second : -1);
+          record.data = rawBuffer.data() + offset;
+          record.size = recordHeader.length;
+          func_(record);
+        }
+        offset += recordHeader.length;
+      }
+    }
+  }
+  inline uint64_t BinaryLogReader::getFirstTimestamp(){
+    BinaryLogIndexEntry entry{};
+    if( this->getNbIndexEntries() == 0 or not this->readIndexEntry(0, entry) ) return 0;
+    return entry.minTimestamp;
+  }
+  inline size_t BinaryLogReader::getNbIndexEntries(){
+    if( _useRebuiltIndex_ ) return _rebuiltIndex_.size();
+    _indexStream_.clear();
+    _indexStream_.seekg(0, std::ios::end);
+    auto indexSize = static_cast<size_t>(_indexStream_.tellg());
+    if( indexSize < sizeof(BinaryLogConstants::indexMagic) ) return 0;
+    return (indexSize - sizeof(BinaryLogConstants::indexMagic)) / sizeof(BinaryLogIndexEntry);
+  }
+  inline bool BinaryLogReader::readIndexEntry(size_t iEntry_, BinaryLogIndexEntry& entry_){
+    if( _useRebuiltIndex_ ){
+      if( iEntry_ >= _rebuiltIndex_.size() ) return false;
+      entry_ = _rebuiltIndex_[iEntry_];
+      return true;
+    }
+    _indexStream_.clear();
+    _indexStream_.seekg(static_cast<std::streamoff>(sizeof(BinaryLogConstants::indexMagic) + iEntry_ * sizeof(BinaryLogIndexEntry)));
+    _indexStream_.read(reinterpret_cast<char*>(&entry_), sizeof(entry_));
+    return bool(_indexStream_);
+  }
+  inline void BinaryLogReader::buildIndexFromData(){
+    _useRebuiltIndex_ = true;
+    _rebuiltIndex_.clear();
+
+    uint64_t runningMax{0};
+    BinaryLogBlockHeader blockHeader{};
+    _dataStream_.clear();
+    _dataStream_.seekg(sizeof(BinaryLogFileHeader));
+    while( true ){
+      auto offset = static_cast<uint64_t>(_dataStream_.tellg());
+      _dataStream_.read(reinterpret_cast<char*>(&blockHeader), sizeof(blockHeader));
+      if( not _dataStream_ or blockHeader.magic != BinaryLogConstants::blockMagic ) break;
+      runningMax = std::max(runningMax, blockHeader.maxTimestamp);
+      _rebuiltIndex_.push_back({offset, blockHeader.minTimestamp, runningMax, blockHeader.levelMask, blockHeader.nRecords});
+      _dataStream_.seekg(blockHeader.storedSize, std::ios::cur);
+    }
+  }
+  inline bool BinaryLogReader::readBlock(uint64_t offset_, BinaryLogBlockHeader& header_, std::string& rawBuffer_){
+    _dataStream_.clear();
+    _dataStream_.seekg(static_cast<std::streamoff>(offset_));
+    _dataStream_.read(reinterpret_cast<char*>(&header_), sizeof(header_));
+    if( not _dataStream_ or header_.magic != BinaryLogConstants::blockMagic ) return false;
+
+    _storedBuffer_.resize(header_.storedSize);
+    _dataStream_.read(&_storedBuffer_[0], header_.storedSize);
+    if( not _dataStream_ ) return false;
+
+    return decompressBlock(static_cast<BinaryLogCodec>(header_.codec), _storedBuffer_.data(), _storedBuffer_.size(), header_.rawSize, rawBuffer_);
+  }
+
+  // Block codec
+  inline bool compressBlock(BinaryLogCodec codec_, const std::string& input_, std::string& output_){
+    switch( codec_ ){
+      case BinaryLogCodec::NONE:
+        output_ = input_;
+        return true;
+#if LOGGER_ENABLE_ZLIB
+      case BinaryLogCodec::ZLIB:{
+        auto outSize = compressBound(static_cast<uLong>(input_.size()));
+        output_.resize(outSize);
+        if( compress2(reinterpret_cast<Bytef*>(&output_[0]), &outSize,
+                      reinterpret_cast<const Bytef*>(input_.data()), static_cast<uLong>(input_.size()), Z_BEST_SPEED) != Z_OK ){
+          return false;
+        }
+        output_.resize(outSize);
+        return true;
+      }
+#endif
+      default:
+        return false;
+    }
+  }
+  inline bool decompressBlock(BinaryLogCodec codec_, const char* input_, size_t inputSize_, size_t rawSize_, std::string& output_){
+    switch( codec_ ){
+      case BinaryLogCodec::NONE:
+        output_.assign(input_, inputSize_);
+        return true;
+#if LOGGER_ENABLE_ZLIB
+      case BinaryLogCodec::ZLIB:{
+        output_.resize(rawSize_);
+        auto outSize = static_cast<uLongf>(rawSize_);
+        if( uncompress(reinterpret_cast<Bytef*>(&output_[0]), &outSize,
+                       reinterpret_cast<const Bytef*>(input_), static_cast<uLong>(inputSize_)) != Z_OK ){
+          return false;
+        }
+        output_.resize(outSize);
+        return true;
+      }
+#endif
+      default:
+        return false;
+    }
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERBINARYFORMAT_IMPL_H
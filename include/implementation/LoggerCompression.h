@@ -0,0 +1,60 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+
+#include <string>
+#include <cstdint>
+
+#if LOGGER_OUTFILE_COMPRESSION == 1 && !LOGGER_ENABLE_ZLIB
+#error "LOGGER_OUTFILE_COMPRESSION=1 (gzip) requires LOGGER_ENABLE_ZLIB=1"
+#endif
+#if LOGGER_OUTFILE_COMPRESSION == 2 && !LOGGER_ENABLE_ZSTD
+#error "LOGGER_OUTFILE_COMPRESSION=2 (zstd) requires LOGGER_ENABLE_ZSTD=1"
+#endif
+
+
+// Streaming compression of the text output files (see LoggerUtils::CompressedFileSink)
+namespace LoggerUtils{
+
+  enum class StreamCodec : int {
+    NONE = 0,
+    GZIP = 1, // requires LOGGER_ENABLE_ZLIB
+    ZSTD = 2  // requires LOGGER_ENABLE_ZSTD
+  };
+
+  inline bool isStreamCodecAvailable(StreamCodec codec_);
+  inline const char* getStreamCodecExtension(StreamCodec codec_); // ".gz", ".zst" or ""
+
+  class StreamCompressor{
+    // One compressed stream (a .gz or .zst file), fed block by block.
+    // Every block ends with a flush point: the output up to the last complete block
+    // can be decompressed even if the stream is never finished (crash, kill -9...).
+  public:
+    StreamCompressor() = default;
+    StreamCompressor(const StreamCompressor&) = delete;
+    StreamCompressor& operator=(const StreamCompressor&) = delete;
+    ~StreamCompressor(){ end(); }
+
+    inline bool begin(StreamCodec codec_);
+    // appends the compressed bytes to out_
+    inline bool compressBlock(const char* data_, size_t size_, std::string& out_);
+    inline bool finish(std::string& out_); // trailer (gzip CRC, zstd epilogue)
+    inline void end();
+
+    StreamCodec getCodec() const { return _codec_; }
+
+  private:
+    inline bool run(const char* data_, size_t size_, bool isLast_, std::string& out_);
+
+    StreamCodec _codec_{StreamCodec::NONE};
+    void* _state_{nullptr}; // z_stream or ZSTD_CCtx
+  };
+
+}
+
+#include "LoggerCompression.impl.h"
@@ -0,0 +1,134 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERCOMPRESSION_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERCOMPRESSION_IMPL_H
+
+#if LOGGER_ENABLE_ZLIB
+#include <zlib.h>
+#endif
+#if LOGGER_ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
+
+namespace LoggerUtils{
+
+  inline bool isStreamCodecAvailable(StreamCodec codec_){
+    switch( codec_ ){
+      case StreamCodec::NONE: return true;
+      case StreamCodec::GZIP: return LOGGER_ENABLE_ZLIB;
+      case StreamCodec::ZSTD: return LOGGER_ENABLE_ZSTD;
+      default: return false;
+    }
+  }
+  inline const char* getStreamCodecExtension(StreamCodec codec_){
+    switch( codec_ ){
+      case StreamCodec::GZIP: return ".gz";
+      case StreamCodec::ZSTD: return ".zst";
+      default: return "";
+    }
+  }
+
+  // StreamCompressor
+  inline bool StreamCompressor::begin(StreamCodec codec_){
+    this->end();
+    switch( codec_ ){
+      case StreamCodec::NONE: break;
+#if LOGGER_ENABLE_ZLIB
+      case StreamCodec::GZIP:{
+        auto* stream = new z_stream();
+        // 15 + 16: gzip header and trailer, readable by zcat
+        if( deflateInit2(stream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK ){ delete stream; return false; }
+        _state_ = stream;
+        break;
+      }
+#endif
+#if LOGGER_ENABLE_ZSTD
+      case StreamCodec::ZSTD:{
+        ZSTD_CCtx* context = ZSTD_createCCtx();
+        if( context == nullptr ) return false;
+        ZSTD_CCtx_setParameter(context, ZSTD_c_compressionLevel, ZSTD_CLEVEL_DEFAULT);
+        ZSTD_CCtx_setParameter(context, ZSTD_c_checksumFlag, 1);
+        _state_ = context;
+        break;
+      }
+#endif
+      default: return false;
+    }
+    _codec_ = codec_;
+    return true;
+  }
+  inline bool StreamCompressor::compressBlock(const char* data_, size_t size_, std::string& out_){
+    return this->run(data_, size_, false, out_);
+  }
+  inline bool StreamCompressor::finish(std::string& out_){
+    return this->run(nullptr, 0, true, out_);
+  }
+  inline void StreamCompressor::end(){
+    if( _state_ == nullptr ) return;
+#if LOGGER_ENABLE_ZLIB
+    if( _codec_ == StreamCodec::GZIP ){
+      deflateEnd(static_cast<z_stream*>(_state_));
+      delete static_cast<z_stream*>(_state_);
+    }
+#endif
+#if LOGGER_ENABLE_ZSTD
+    if( _codec_ == StreamCodec::ZSTD ){ ZSTD_freeCCtx(static_cast<ZSTD_CCtx*>(_state_)); }
+#endif
+    _state_ = nullptr;
+    _codec_ = StreamCodec::NONE;
+  }
+  inline bool StreamCompressor::run(const char* data_, size_t size_, bool isLast_, std::string& out_){
+    if( _codec_ == StreamCodec::NONE ){
+      out_.append(data_, size_);
+      return true;
+    }
+    if( _state_ == nullptr ) return false;
+
+#if LOGGER_ENABLE_ZLIB
+    if( _codec_ == StreamCodec::GZIP ){
+      auto* stream = static_cast<z_stream*>(_state_);
+      // Z_FULL_FLUSH: byte aligned and no back reference across the blocks -> resync point for the recovery tools
+      int flushMode = ( isLast_ ? Z_FINISH : Z_FULL_FLUSH );
+      stream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data_));
+      stream->avail_in = static_cast<uInt>(size_);
+      int status;
+      do{
+        size_t outOffset = out_.size();
+        size_t chunkSize = deflateBound(stream, stream->avail_in) + 64;
+        out_.resize(outOffset + chunkSize);
+        stream->next_out = reinterpret_cast<Bytef*>(&out_[outOffset]);
+        stream->avail_out = static_cast<uInt>(chunkSize);
+        status = deflate(stream, flushMode);
+        out_.resize(outOffset + chunkSize - stream->avail_out);
+        if( status == Z_STREAM_ERROR ) return false;
+      } while( stream->avail_out == 0 or (isLast_ and status != Z_STREAM_END) );
+      return true;
+    }
+#endif
+#if LOGGER_ENABLE_ZSTD
+    if( _codec_ == StreamCodec::ZSTD ){
+      auto* context = static_cast<ZSTD_CCtx*>(_state_);
+      ZSTD_EndDirective directive = ( isLast_ ? ZSTD_e_end : ZSTD_e_flush );
+      ZSTD_inBuffer input{data_, size_, 0};
+      size_t remaining;
+      do{
+        size_t outOffset = out_.size();
+        size_t chunkSize = ZSTD_CStreamOutSize();
+        out_.resize(outOffset + chunkSize);
+        ZSTD_outBuffer output{&out_[outOffset], chunkSize, 0};
+        remaining = ZSTD_compressStream2(context, &output, &input, directive);
+        out_.resize(outOffset + output.pos);
+        if( ZSTD_isError(remaining) ) return false;
+      } while( remaining != 0 or input.pos != input.size );
+      return true;
+    }
+#endif
+    return false;
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERCOMPRESSION_IMPL_H
@@ -0,0 +1,67 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <sstream>
+#include <type_traits>
+
+
+// Per-thread state rendered in the prefix: indentation and mapped diagnostic context (MDC)
+namespace LoggerUtils{
+
+  // Indentation
+  inline const std::string& getIndentStr(int depth_); // preallocated table of LOGGER_INDENT_TABLE_SIZE entries
+
+  struct IndentState{
+    int depth{0};
+    bool isCustom{false};   // set through Logger::setIndentStr()
+    std::string customStr{};
+
+    inline const std::string& getStr() const { return ( isCustom ? customStr : LoggerUtils::getIndentStr(depth) ); }
+    inline void increase();
+    inline void decrease();
+    inline void set(const std::string& indentStr_);
+  };
+
+  // Mapped diagnostic context
+  class ContextStack{
+    // Entries are never released: once the stack reached its max depth, push/pop don't allocate anymore
+  public:
+    template<typename T> inline void push(const char* key_, const T& value_);
+    inline void pop();
+
+    inline bool empty() const { return _size_ == 0; }
+    inline const std::string& getRenderedStr() const; // "key1=value1 key2=value2"
+
+  private:
+    struct Entry{
+      std::string key;
+      std::string value;
+    };
+
+    inline Entry& pushEntry(const char* key_);
+
+    template<typename T> inline static void formatValue(std::string& out_, const T& value_, std::true_type /* isArithmetic */);
+    template<typename T> inline static void formatValue(std::string& out_, const T& value_, std::false_type /* isArithmetic */);
+    inline static void formatValue(std::string& out_, const std::string& value_, std::false_type){ out_.assign(value_); }
+    inline static void formatValue(std::string& out_, const char* value_, std::false_type){ out_.assign(value_); }
+    inline static void formatValue(std::string& out_, bool value_, std::true_type){ out_.assign(value_ ? "true" : "false"); }
+
+    size_t _size_{0};
+    std::vector<Entry> _entryList_{};
+    mutable bool _isRendered_{false};
+    mutable std::string _renderedStr_{};
+  };
+  inline ContextStack& getContextStack(){ static thread_local ContextStack contextStack; return contextStack; }
+
+}
+
+#include "LoggerContext.impl.h"
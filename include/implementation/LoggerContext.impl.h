@@ -0,0 +1,82 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERCONTEXT_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERCONTEXT_IMPL_H
+
+
+namespace LoggerUtils{
+
+  // Indentation
+  inline const std::string& getIndentStr(int depth_){
+    static const std::vector<std::string> indentTable = []{
+      std::vector<std::string> out(LOGGER_INDENT_TABLE_SIZE);
+      for( size_t iDepth = 0 ; iDepth < out.size() ; iDepth++ ){ out[iDepth] = std::string(2 * iDepth, ' '); }
+      return out;
+    }();
+    if( depth_ < 0 ) depth_ = 0;
+    if( depth_ >= int(indentTable.size()) ) depth_ = int(indentTable.size()) - 1; // saturates
+    return indentTable[depth_];
+  }
+  inline void IndentState::increase(){
+    if( isCustom ){ customStr += "  "; }
+    depth++;
+  }
+  inline void IndentState::decrease(){
+    if( isCustom ){ customStr.resize( customStr.size() >= 2 ? customStr.size() - 2 : 0 ); }
+    if( depth > 0 ) depth--;
+  }
+  inline void IndentState::set(const std::string& indentStr_){
+    depth = int(indentStr_.size() / 2);
+    // the table can be used if the string is made of spaces only
+    isCustom = ( indentStr_.size() % 2 != 0 or indentStr_.find_first_not_of(' ') != std::string::npos );
+    if( isCustom ) customStr = indentStr_;
+  }
+
+  // Mapped diagnostic context
+  template<typename T> inline void ContextStack::push(const char* key_, const T& value_){
+    auto& entry = this->pushEntry(key_);
+    formatValue(entry.value, value_, std::is_arithmetic<T>());
+  }
+  inline void ContextStack::pop(){
+    if( _size_ == 0 ) return;
+    _size_--;
+    _isRendered_ = false;
+  }
+  inline const std::string& ContextStack::getRenderedStr() const {
+    if( _isRendered_ ) return _renderedStr_;
+    _renderedStr_.clear();
+    for( size_t iEntry = 0 ; iEntry < _size_ ; iEntry++ ){
+      if( iEntry != 0 ) _renderedStr_ += ' ';
+      _renderedStr_ += _entryList_[iEntry].key;
+      _renderedStr_ += '=';
+      _renderedStr_ += _entryList_[iEntry].value;
+    }
+    _isRendered_ = true;
+    return _renderedStr_;
+  }
+  inline ContextStack::Entry& ContextStack::pushEntry(const char* key_){
+    if( _size_ == _entryList_.size() ) _entryList_.emplace_back();
+    auto& entry = _entryList_[_size_++];
+    entry.key.assign(key_);
+    _isRendered_ = false;
+    return entry;
+  }
+  template<typename T> inline void ContextStack::formatValue(std::string& out_, const T& value_, std::true_type){
+    char buffer[32];
+    int nChars;
+    if( std::is_floating_point<T>::value ){ nChars = std::snprintf(buffer, sizeof(buffer), "%g", static_cast<double>(value_)); }
+    else if( std::is_signed<T>::value ){ nChars = std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(value_)); }
+    else{ nChars = std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value_)); }
+    out_.assign(buffer, nChars > 0 ? size_t(nChars) : 0);
+  }
+  template<typename T> inline void ContextStack::formatValue(std::string& out_, const T& value_, std::false_type){
+    std::stringstream ss;
+    ss << value_;
+    out_.assign(ss.str());
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERCONTEXT_IMPL_H
@@ -0,0 +1,66 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+#include "LoggerMacros.h"
+
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+// Runtime filters on the call sites (see Logger::addIncludeFilter): the rules are matched the first time a site prints,
+// the result is cached in the static state of the site until the rules change
+namespace LoggerUtils{
+
+  inline bool isGlobMatching(const char* pattern_, const char* str_); // '*': any sequence, '?': any character
+
+  struct LogFilterRule{
+    std::string fileGlob{};  // matched against FILENAME (without the folders)
+    int firstLine{0};
+    int lastLine{INT32_MAX};
+    int maxLogLevel{-1};     // of the matching sites, -1 to mute them
+
+    inline static LogFilterRule parse(const std::string& spec_, int maxLogLevel_); // "file.cpp", "file*.cpp:42", "file.cpp:100-200" or "file.cpp:*"
+    inline bool isMatching(const char* fileName_, int lineNumber_) const;
+  };
+
+  struct LogFilterSite{
+    // Static state of a print statement: constant-initialized, nothing is done before it fires
+    std::atomic<uint32_t> state{0}; // generation of the rules << 4 | (max log level + 2), 0 if no rule matches
+  };
+
+  class LogFilterRegistry{
+    // Shared by all the source files
+  public:
+    static const int noMatch = -2; // the site follows the max log level of its source file
+
+    inline void addRule(const LogFilterRule& rule_); // the last matching rule wins
+    inline void clear();
+    inline std::vector<LogFilterRule> getRuleList();
+
+    inline int resolve(LogFilterSite& site_, const char* fileName_, int lineNumber_); // slow path of getSiteMaxLogLevel()
+
+  private:
+    std::mutex _mutex_{};
+    std::vector<LogFilterRule> _ruleList_{};
+  };
+  inline LogFilterRegistry& getLogFilterRegistry(){ static LogFilterRegistry registry; return registry; }
+  inline std::atomic<uint32_t>& getLogFilterGeneration(){ static std::atomic<uint32_t> generation{0}; return generation; } // constant-initialized: no guard
+
+  // max log level of the site, or LogFilterRegistry::noMatch. Once resolved: one load and one compare.
+  inline int getSiteMaxLogLevel(LogFilterSite& site_, const char* fileName_, int lineNumber_){
+    uint32_t state = site_.state.load(std::memory_order_relaxed);
+    if( LOGGER_LIKELY((state >> 4) == getLogFilterGeneration().load(std::memory_order_relaxed)) ){ return int(state & 0xfu) - 2; }
+    return getLogFilterRegistry().resolve(site_, fileName_, lineNumber_);
+  }
+
+}
+
+#include "LoggerFilters.impl.h"
@@ -0,0 +1,87 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERFILTERS_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERFILTERS_IMPL_H
+
+#include <cstdlib>
+#include <stdexcept>
+
+
+namespace LoggerUtils{
+
+  inline bool isGlobMatching(const char* pattern_, const char* str_){
+    // greedy with a single backtrack point: the last '*' seen
+    const char* starPattern{nullptr};
+    const char* starStr{nullptr};
+    while( *str_ != '\0' ){
+      if( *pattern_ == '*' ){ starPattern = pattern_++; starStr = str_; }
+      else if( *pattern_ == '?' or *pattern_ == *str_ ){ pattern_++; str_++; }
+      else if( starPattern != nullptr ){ pattern_ = starPattern + 1; str_ = ++starStr; }
+      else{ return false; }
+    }
+    while( *pattern_ == '*' ){ pattern_++; }
+    return *pattern_ == '\0';
+  }
+
+  // LogFilterRule
+  inline LogFilterRule LogFilterRule::parse(const std::string& spec_, int maxLogLevel_){
+    LogFilterRule rule;
+    rule.maxLogLevel = maxLogLevel_;
+    rule.fileGlob = spec_;
+
+    auto colonPos = spec_.rfind(':');
+    if( colonPos == std::string::npos ) return rule;
+
+    std::string linesStr{spec_.substr(colonPos + 1)};
+    rule.fileGlob = spec_.substr(0, colonPos);
+    if( linesStr == "*" ) return rule;
+
+    auto parseLine = [&](const std::string& str_){
+      char* end{nullptr};
+      long line = std::strtol(str_.c_str(), &end, 10);
+      if( str_.empty() or *end != '\0' or line < 0 ){ throw std::runtime_error("Invalid line range in log filter \"" + spec_ + "\""); }
+      return int(line);
+    };
+    auto dashPos = linesStr.find('-');
+    rule.firstLine = parseLine(linesStr.substr(0, dashPos));
+    rule.lastLine = ( dashPos == std::string::npos ? rule.firstLine : parseLine(linesStr.substr(dashPos + 1)) );
+    return rule;
+  }
+  inline bool LogFilterRule::isMatching(const char* fileName_, int lineNumber_) const {
+    return lineNumber_ >= firstLine and lineNumber_ <= lastLine and isGlobMatching(fileGlob.c_str(), fileName_);
+  }
+
+  // LogFilterRegistry
+  inline void LogFilterRegistry::addRule(const LogFilterRule& rule_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    _ruleList_.emplace_back(rule_);
+    // invalidates the cached results. 0 is skipped: it's the state of the sites which never printed
+    uint32_t generation = getLogFilterGeneration().load(std::memory_order_relaxed);
+    getLogFilterGeneration().store(generation % 0x0fffffffu + 1, std::memory_order_relaxed);
+  }
+  inline void LogFilterRegistry::clear(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    _ruleList_.clear();
+    uint32_t generation = getLogFilterGeneration().load(std::memory_order_relaxed);
+    getLogFilterGeneration().store(generation % 0x0fffffffu + 1, std::memory_order_relaxed);
+  }
+  inline std::vector<LogFilterRule> LogFilterRegistry::getRuleList(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    return _ruleList_;
+  }
+  inline int LogFilterRegistry::resolve(LogFilterSite& site_, const char* fileName_, int lineNumber_){
+    std::lock_guard<std::mutex> lock(_mutex_); // the generation can't change while the rules are matched
+    int maxLogLevel{noMatch};
+    for( auto& rule : _ruleList_ ){
+      if( rule.isMatching(fileName_, lineNumber_) ){ maxLogLevel = rule.maxLogLevel; }
+    }
+    uint32_t generation = getLogFilterGeneration().load(std::memory_order_relaxed);
+    site_.state.store(generation << 4 | uint32_t(maxLogLevel + 2), std::memory_order_relaxed);
+    return maxLogLevel;
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERFILTERS_IMPL_H
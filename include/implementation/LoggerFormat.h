@@ -0,0 +1,113 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+#include "LoggerMacros.h"
+
+#include <string>
+#include <cstdio>
+#include <limits>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+
+#if HAS_CPP_17 && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define LOGGER_HAS_TO_CHARS 1 // integers and floating points, otherwise snprintf is used
+#else
+#define LOGGER_HAS_TO_CHARS 0
+#endif
+
+#if HAS_CPP_14
+#define LOGGER_CONSTEXPR14 constexpr
+#else
+#define LOGGER_CONSTEXPR14 inline
+#endif
+
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L
+#define LOGGER_HAS_CONSTEVAL 1
+#else
+#define LOGGER_HAS_CONSTEVAL 0
+#endif
+
+
+// "{}" formatting used by Logger::fmt()
+// Placeholders: {} or {:[width][.precision][type]}, with type among d x X o f e g s. "{{" and "}}" print braces.
+namespace LoggerUtils{
+
+  struct FormatSpec{
+    int width{-1};
+    int precision{-1};
+    char type{'\0'};
+  };
+
+  // parses the spec between '{' and '}', returns nullptr if invalid
+  LOGGER_CONSTEXPR14 const char* parseFormatSpec(const char* begin_, const char* end_, FormatSpec& spec_);
+
+  // type-erased argument, so the placeholders can be filled without recursion
+  struct FormatArg{
+    const void* value;
+    void (*formatFct)(std::string& out_, const void* value_, const FormatSpec& spec_);
+  };
+  template<typename T> inline FormatArg makeFormatArg(const T& value_);
+
+  // appends to out_: no intermediate string
+  inline void formatTo(std::string& out_, const char* fmt_, size_t size_, const FormatArg* argList_, size_t nArgs_);
+
+  enum class FormatCategory{ Bool, Char, Integral, Floating, CString, String, Pointer, Streamed };
+  template<typename T> constexpr FormatCategory getFormatCategory();
+  template<typename T> inline void formatValue(std::string& out_, const T& value_, const FormatSpec& spec_);
+
+  template<typename T> struct TypeIdentity{ typedef T type; }; // disables the deduction from the format string
+
+#if LOGGER_HAS_CONSTEVAL
+  // not constexpr on purpose: calling them in a consteval context shows up as a compilation error
+  inline void logger_format_error_unmatched_brace(){}
+  inline void logger_format_error_invalid_spec(){}
+  inline void logger_format_error_too_few_arguments(){}
+  inline void logger_format_error_too_many_arguments(){}
+  inline void logger_format_error_numeric_spec_on_non_numeric_argument(){}
+
+  template<typename... Args> consteval void checkFormatString(const char* str_, size_t size_);
+#endif
+
+  // Bounded printing of containers and iterator ranges (LogRange): at most maxElements elements are formatted,
+  // straight into the output string, then the rest is elided with its count: "[1, 2, 3, ... (+997 more)]".
+  // Maps are printed as "{key: value, ...}", nested containers with the same cap.
+  template<typename Iterator> struct RangeView{
+    Iterator begin;
+    Iterator end;
+    size_t maxElements;
+    size_t size; // npos if it can't be known without walking the range
+  };
+  template<typename Container> inline auto makeRangeView(const Container& container_, size_t maxElements_ = LOGGER_RANGE_MAX_ELEMENTS)
+      -> RangeView<decltype(std::begin(container_))>;
+  template<typename Iterator> inline RangeView<Iterator> makeRangeView(Iterator begin_, Iterator end_, size_t maxElements_ = LOGGER_RANGE_MAX_ELEMENTS);
+  template<typename Iterator> inline void formatRange(std::string& out_, const RangeView<Iterator>& range_);
+  template<typename Iterator> inline std::ostream& operator<<(std::ostream& stream_, const RangeView<Iterator>& range_);
+
+  template<typename... Args> struct FormatString{
+    // Only string literals: with C++20, the format string is checked against the arguments at compile time
+#if LOGGER_HAS_CONSTEVAL
+    template<size_t N> consteval FormatString(const char (&str_)[N]) : str(str_), size(N - 1) { checkFormatString<Args...>(str_, N - 1); }
+#else
+    template<size_t N> constexpr FormatString(const char (&str_)[N]) : str(str_), size(N - 1) {}
+#endif
+    const char* str;
+    size_t size;
+  };
+
+}
+
+#include "LoggerFormat.impl.h"
@@ -0,0 +1,291 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERFORMAT_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERFORMAT_IMPL_H
+
+#include <cctype>
+#include <algorithm>
+
+
+namespace LoggerUtils{
+
+  LOGGER_CONSTEXPR14 const char* parseFormatSpec(const char* begin_, const char* end_, FormatSpec& spec_){
+    spec_ = FormatSpec();
+    const char* c = begin_;
+    if( c == end_ ) return c; // "{}"
+    if( *c++ != ':' ) return nullptr;
+    if( c != end_ and *c >= '0' and *c <= '9' ){
+      spec_.width = 0;
+      while( c != end_ and *c >= '0' and *c <= '9' ){ spec_.width = 10 * spec_.width + (*c++ - '0'); }
+    }
+    if( c != end_ and *c == '.' ){
+      c++;
+      if( c == end_ or *c < '0' or *c > '9' ) return nullptr;
+      spec_.precision = 0;
+      while( c != end_ and *c >= '0' and *c <= '9' ){ spec_.precision = 10 * spec_.precision + (*c++ - '0'); }
+    }
+    if( c != end_ ){
+      switch( *c ){
+        case 'd': case 'x': case 'X': case 'o': case 'f': case 'e': case 'g': case 's': spec_.type = *c++; break;
+        default: return nullptr;
+      }
+    }
+    return ( c == end_ ? c : nullptr );
+  }
+
+  template<typename T> inline void formatArgValue(std::string& out_, const void* value_, const FormatSpec& spec_){
+    size_t begin = out_.size();
+    formatValue(out_, *static_cast<const T*>(value_), spec_);
+    size_t length = out_.size() - begin;
+    if( spec_.width <= 0 or length >= size_t(spec_.width) ) return;
+
+    // numbers are aligned to the right, text to the left
+    auto category = getFormatCategory<typename std::decay<const T>::type>();
+    if( category == FormatCategory::Integral or category == FormatCategory::Floating ){ out_.insert(begin, size_t(spec_.width) - length, ' '); }
+    else{ out_.append(size_t(spec_.width) - length, ' '); }
+  }
+  template<typename T> inline FormatArg makeFormatArg(const T& value_){
+    return { static_cast<const void*>(&value_), &formatArgValue<T> };
+  }
+
+  inline void formatTo(std::string& out_, const char* fmt_, size_t size_, const FormatArg* argList_, size_t nArgs_){
+    const char* end = fmt_ + size_;
+    const char* c = fmt_;
+    size_t iArg{0};
+    FormatSpec spec;
+    while( c != end ){
+      // copy the literal chunk at once
+      const char* nextBrace = c;
+      while( nextBrace != end and *nextBrace != '{' and *nextBrace != '}' ){ nextBrace++; }
+      out_.append(c, size_t(nextBrace - c));
+      c = nextBrace;
+      if( c == end ) break;
+
+      if( c + 1 != end and c[1] == *c ){ out_ += *c; c += 2; continue; } // "{{" or "}}"
+      if( *c == '}' ){ out_ += *c++; continue; } // lonely '}': printed as is
+
+      const char* close = c + 1;
+      while( close != end and *close != '}' and *close != '{' ){ close++; }
+      if( close == end or *close == '{' or parseFormatSpec(c + 1, close, spec) == nullptr ){
+        // not a placeholder: printed as is
+        out_.append(c, size_t(close - c));
+        c = close;
+        continue;
+      }
+
+      if( iArg < nArgs_ ){
+        argList_[iArg].formatFct(out_, argList_[iArg].value, spec);
+      }
+      else{
+        out_ += "{?}"; // missing argument (checked at compile time with C++20)
+      }
+      iArg++;
+      c = close + 1;
+    }
+  }
+
+  template<typename T> constexpr FormatCategory getFormatCategory(){
+    return std::is_same<T, bool>::value ? FormatCategory::Bool
+         : std::is_same<T, char>::value ? FormatCategory::Char
+         : std::is_integral<T>::value ? FormatCategory::Integral
+         : std::is_floating_point<T>::value ? FormatCategory::Floating
+         : std::is_same<T, const char*>::value or std::is_same<T, char*>::value ? FormatCategory::CString
+         : std::is_same<T, std::string>::value ? FormatCategory::String
+         : std::is_pointer<T>::value ? FormatCategory::Pointer
+         : FormatCategory::Streamed;
+  }
+
+  template<FormatCategory C> using FormatCategoryTag = std::integral_constant<FormatCategory, C>;
+
+  template<typename T> inline void formatValueImpl(std::string& out_, const T& value_, const FormatSpec&, FormatCategoryTag<FormatCategory::Bool>){
+    out_ += ( value_ ? "true" : "false" );
+  }
+  template<typename T> inline void formatValueImpl(std::string& out_, const T& value_, const FormatSpec&, FormatCategoryTag<FormatCategory::Char>){
+    out_ += value_;
+  }
+  template<typename T> inline void formatValueImpl(std::string& out_, const T& value_, const FormatSpec& spec_, FormatCategoryTag<FormatCategory::Floating>){
+    char buffer[512];
+    int precision = std::min(spec_.precision, 100);
+    size_t length{0};
+#if LOGGER_HAS_TO_CHARS
+    std::to_chars_result result{};
+    if( spec_.type == '\0' and precision < 0 ){
+      result = std::to_chars(buffer, buffer + sizeof(buffer), value_); // shortest round-trip representation
+    }
+    else{
+      std::chars_format format = ( spec_.type == 'e' ? std::chars_format::scientific : spec_.type == 'g' ? std::chars_format::general : std::chars_format::fixed );
+      result = std::to_chars(buffer, buffer + sizeof(buffer), value_, format, precision < 0 ? 6 : precision);
+    }
+    length = ( result.ec == std::errc() ? size_t(result.ptr - buffer) : 0 );
+#else
+    int nChars;
+    if( spec_.type == '\0' and precision < 0 ){ nChars = std::snprintf(buffer, sizeof(buffer), "%g", double(value_)); }
+    else{
+      const char* format = ( spec_.type == 'e' ? "%.*e" : spec_.type == 'g' ? "%.*g" : "%.*f" );
+      nChars = std::snprintf(buffer, sizeof(buffer), format, precision < 0 ? 6 : precision, double(value_));
+    }
+    length = ( nChars > 0 ? std::min(size_t(nChars), sizeof(buffer) - 1) : 0 );
+#endif
+    out_.append(buffer, length);
+  }
+  template<typename T> inline void formatValueImpl(std::string& out_, const T& value_, const FormatSpec& spec_, FormatCategoryTag<FormatCategory::Integral>){
+    if( spec_.type == 'f' or spec_.type == 'e' or spec_.type == 'g' or (spec_.type == '\0' and spec_.precision >= 0) ){
+      formatValueImpl(out_, double(value_), spec_, FormatCategoryTag<FormatCategory::Floating>());
+      return;
+    }
+    char buffer[32];
+    size_t length{0};
+    int base = ( spec_.type == 'x' or spec_.type == 'X' ? 16 : spec_.type == 'o' ? 8 : 10 );
+#if LOGGER_HAS_TO_CHARS
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value_, base);
+    length = size_t(result.ptr - buffer);
+    if( spec_.type == 'X' ){ std::transform(buffer, buffer + length, buffer, [](char c_){ return char(std::toupper(static_cast<unsigned char>(c_))); }); }
+#else
+    int nChars;
+    if( base == 10 ){
+      if( std::is_signed<T>::value ){ nChars = std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(value_)); }
+      else{ nChars = std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value_)); }
+    }
+    else{
+      // same output as to_chars for negative numbers
+      const char* format = ( spec_.type == 'x' ? "%s%llx" : spec_.type == 'X' ? "%s%llX" : "%s%llo" );
+      bool isNegative = ( value_ < T(0) );
+      auto absValue = ( isNegative ? 0ULL - static_cast<unsigned long long>(value_) : static_cast<unsigned long long>(value_) );
+      nChars = std::snprintf(buffer, sizeof(buffer), format, isNegative ? "-" : "", absValue);
+    }
+    length = ( nChars > 0 ? size_t(nChars) : 0 );
+#endif
+    out_.append(buffer, length);
+  }
+  template<typename T> inline void formatValueImpl(std::string& out_, const T& value_, const FormatSpec&, FormatCategoryTag<FormatCategory::CString>){
+    if( value_ != nullptr ) out_ += value_;
+  }
+  template<typename T> inline void formatValueImpl(std::string& out_, const T& value_, const FormatSpec&, FormatCategoryTag<FormatCategory::String>){
+    out_ += value_;
+  }
+  template<typename T> inline void formatValueImpl(std::string& out_, const T& value_, const FormatSpec&, FormatCategoryTag<FormatCategory::Pointer>){
+    char buffer[32];
+    int nChars = std::snprintf(buffer, sizeof(buffer), "%p", static_cast<const void*>(value_));
+    out_.append(buffer, nChars > 0 ? size_t(nChars) : 0);
+  }
+  template<typename T> inline void formatValueImpl(std::string& out_, const T& value_, const FormatSpec&, FormatCategoryTag<FormatCategory::Streamed>){
+    // any other type with an operator<<
+    std::ostringstream ss;
+    ss << value_;
+    out_ += ss.str();
+  }
+
+  template<typename T> inline void formatValue(std::string& out_, const T& value_, const FormatSpec& spec_){
+    // arrays (string literals) are handled as pointers
+    typedef typename std::decay<const T>::type DecayedT;
+    formatValueImpl<DecayedT>(out_, value_, spec_, FormatCategoryTag<getFormatCategory<DecayedT>()>());
+  }
+
+  // Ranges
+  template<typename T, typename = void> struct IsRange : std::false_type {};
+  template<typename T> struct IsRange<T, decltype(std::begin(std::declval<const T&>()), std::end(std::declval<const T&>()), void())>
+      : std::integral_constant<bool, not std::is_same<T, std::string>::value and not std::is_array<T>::value> {}; // text is printed as text
+  template<typename T> struct IsPair : std::false_type {};
+  template<typename T1, typename T2> struct IsPair<std::pair<T1, T2>> : std::true_type {};
+
+  template<typename Iterator> inline size_t getRangeSize(Iterator begin_, Iterator end_, std::random_access_iterator_tag){ return size_t(std::distance(begin_, end_)); }
+  template<typename Iterator> inline size_t getRangeSize(Iterator, Iterator, std::input_iterator_tag){ return std::numeric_limits<size_t>::max(); } // not walked twice
+  template<typename Container> inline auto getRangeSize(const Container& container_, int) -> decltype(size_t(container_.size())) { return size_t(container_.size()); }
+  template<typename Container> inline size_t getRangeSize(const Container& container_, long){
+    // arrays, forward_list...
+    return getRangeSize(std::begin(container_), std::end(container_), typename std::iterator_traits<decltype(std::begin(container_))>::iterator_category());
+  }
+
+  template<typename Container> inline auto makeRangeView(const Container& container_, size_t maxElements_)
+      -> RangeView<decltype(std::begin(container_))> {
+    return { std::begin(container_), std::end(container_), maxElements_, getRangeSize(container_, 0) };
+  }
+  template<typename Iterator> inline RangeView<Iterator> makeRangeView(Iterator begin_, Iterator end_, size_t maxElements_){
+    return { begin_, end_, maxElements_, getRangeSize(begin_, end_, typename std::iterator_traits<Iterator>::iterator_category()) };
+  }
+
+  template<typename T> inline void formatRangeElement(std::string& out_, const T& element_, size_t maxElements_);
+  template<typename T> inline void formatRangeElementImpl(std::string& out_, const T& element_, size_t, std::false_type /* is range */, std::false_type /* is pair */){
+    formatValue(out_, element_, FormatSpec());
+  }
+  template<typename T> inline void formatRangeElementImpl(std::string& out_, const T& element_, size_t maxElements_, std::true_type, std::false_type){
+    formatRange(out_, makeRangeView(element_, maxElements_));
+  }
+  template<typename T, typename IsRangeT> inline void formatRangeElementImpl(std::string& out_, const T& element_, size_t maxElements_, IsRangeT, std::true_type){
+    formatRangeElement(out_, element_.first, maxElements_);
+    out_ += ": ";
+    formatRangeElement(out_, element_.second, maxElements_);
+  }
+  template<typename T> inline void formatRangeElement(std::string& out_, const T& element_, size_t maxElements_){
+    formatRangeElementImpl(out_, element_, maxElements_, IsRange<T>(), IsPair<typename std::remove_cv<T>::type>());
+  }
+
+  template<typename Iterator> inline void formatRange(std::string& out_, const RangeView<Iterator>& range_){
+    typedef typename std::iterator_traits<Iterator>::value_type ElementT;
+    bool isMap = IsPair<typename std::remove_cv<ElementT>::type>::value;
+    out_ += ( isMap ? '{' : '[' );
+    size_t nPrinted{0};
+    Iterator it = range_.begin;
+    for( ; it != range_.end and nPrinted < range_.maxElements ; ++it, ++nPrinted ){
+      if( nPrinted != 0 ){ out_ += ", "; }
+      formatRangeElement(out_, *it, range_.maxElements);
+    }
+    if( it != range_.end ){
+      // the rest is neither formatted nor walked
+      out_ += ( nPrinted != 0 ? ", ..." : "..." );
+      if( range_.size != std::numeric_limits<size_t>::max() ){
+        out_ += " (+";
+        out_ += std::to_string(range_.size - nPrinted);
+        out_ += " more)";
+      }
+    }
+    out_ += ( isMap ? '}' : ']' );
+  }
+  template<typename Iterator> inline std::ostream& operator<<(std::ostream& stream_, const RangeView<Iterator>& range_){
+    std::string str;
+    formatRange(str, range_);
+    return stream_ << str;
+  }
+
+#if LOGGER_HAS_CONSTEVAL
+  template<typename... Args> consteval void checkFormatString(const char* str_, size_t size_){
+    // first entry is a placeholder: no zero-sized array
+    constexpr bool isIntegralList[] = {false, (std::is_integral<std::decay_t<Args>>::value and not std::is_same<std::decay_t<Args>, bool>::value)...};
+    constexpr bool isFloatingList[] = {false, std::is_floating_point<std::decay_t<Args>>::value...};
+    constexpr size_t nArgs = sizeof...(Args);
+
+    size_t iArg{0};
+    const char* end = str_ + size_;
+    for( const char* c = str_ ; c != end ; c++ ){
+      if( *c != '{' and *c != '}' ) continue;
+      if( c + 1 != end and c[1] == *c ){ c++; continue; }
+      if( *c == '}' ){ logger_format_error_unmatched_brace(); }
+
+      const char* close = c + 1;
+      while( close != end and *close != '}' and *close != '{' ){ close++; }
+      if( close == end or *close == '{' ){ logger_format_error_unmatched_brace(); }
+
+      FormatSpec spec;
+      if( parseFormatSpec(c + 1, close, spec) == nullptr ){ logger_format_error_invalid_spec(); }
+      if( iArg >= nArgs ){ logger_format_error_too_few_arguments(); }
+
+      bool isIntegral = isIntegralList[iArg + 1];
+      bool isFloating = isFloatingList[iArg + 1];
+      bool isIntegerSpec = ( spec.type == 'd' or spec.type == 'x' or spec.type == 'X' or spec.type == 'o' );
+      bool isFloatingSpec = ( spec.type == 'f' or spec.type == 'e' or spec.type == 'g' or spec.precision >= 0 );
+      if( (isIntegerSpec and not isIntegral) or (isFloatingSpec and not isIntegral and not isFloating) ){
+        logger_format_error_numeric_spec_on_non_numeric_argument();
+      }
+
+      iArg++;
+      c = close;
+    }
+    if( iArg != nArgs ){ logger_format_error_too_many_arguments(); }
+  }
+#endif
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERFORMAT_IMPL_H
@@ -0,0 +1,43 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+
+// Hex dumps of binary buffers (see LogHex), as "hexdump -C":
+// 00000000  48 65 6c 6c 6f 2c 20 77  6f 72 6c 64 21 0a 00 ff  |Hello, world!...|
+namespace LoggerUtils{
+
+  // 2 lowercase hex digits per byte, vectorized (AVX2, SSE2 or scalar, chosen at compile time)
+  inline void encodeHex(const void* data_, size_t size_, char* out_);
+  // printable ASCII bytes are copied, the others become '.'
+  inline void encodePrintable(const void* data_, size_t size_, char* out_);
+
+  // rows separated by '\n', no line jump after the last one. Past maxBytes_, the rest is elided with its size.
+  inline void formatHexDump(std::string& out_, const void* data_, size_t size_, size_t maxBytes_ = LOGGER_HEX_MAX_BYTES);
+  inline std::string getHexDumpStr(const void* data_, size_t size_, size_t maxBytes_ = LOGGER_HEX_MAX_BYTES);
+
+  struct HexView{
+    const void* data;
+    size_t size;
+    size_t maxBytes;
+  };
+  inline HexView makeHexView(const void* data_, size_t size_, size_t maxBytes_ = LOGGER_HEX_MAX_BYTES){ return {data_, size_, maxBytes_}; }
+  template<typename Container> inline auto makeHexView(const Container& container_, size_t maxBytes_ = LOGGER_HEX_MAX_BYTES)
+      -> decltype(container_.data(), container_.size(), HexView()) { // std::vector, std::string, std::array...
+    return {container_.data(), container_.size() * sizeof(*container_.data()), maxBytes_};
+  }
+  inline std::ostream& operator<<(std::ostream& stream_, const HexView& hexView_);
+
+}
+
+#include "LoggerHex.impl.h"
@@ -0,0 +1,157 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERHEX_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERHEX_IMPL_H
+
+#include <cstring>
+#include <algorithm>
+
+#if LOGGER_USE_AVX2
+#include <immintrin.h>
+#endif
+#if LOGGER_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace LoggerUtils{
+
+  // Kernels: each byte is split in its 2 nibbles, which are turned into digits with a compare instead of a table lookup:
+  // '0' + nibble, plus ('a' - '0' - 10) if nibble > 9. The digits of the high and low nibbles are then interleaved.
+#if LOGGER_USE_AVX2
+  inline __m256i getHexDigitsAvx2(__m256i nibbles_){
+    __m256i letterOffset = _mm256_and_si256(_mm256_cmpgt_epi8(nibbles_, _mm256_set1_epi8(9)), _mm256_set1_epi8('a' - '0' - 10));
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles_, _mm256_set1_epi8('0')), letterOffset);
+  }
+#endif
+#if LOGGER_USE_SSE2
+  inline __m128i getHexDigitsSse2(__m128i nibbles_){
+    __m128i letterOffset = _mm_and_si128(_mm_cmpgt_epi8(nibbles_, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles_, _mm_set1_epi8('0')), letterOffset);
+  }
+#endif
+
+  inline void encodeHex(const void* data_, size_t size_, char* out_){
+    const uint8_t* in = static_cast<const uint8_t*>(data_);
+    size_t iByte{0};
+#if LOGGER_USE_AVX2
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+    for( ; iByte + 32 <= size_ ; iByte += 32 ){
+      __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + iByte));
+      __m256i high = getHexDigitsAvx2(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibbleMask));
+      __m256i low = getHexDigitsAvx2(_mm256_and_si256(bytes, nibbleMask));
+      // the unpacks work within each 128-bit lane: bytes 0-7 and 16-23, then 8-15 and 24-31
+      __m256i first = _mm256_unpacklo_epi8(high, low);
+      __m256i second = _mm256_unpackhi_epi8(high, low);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_ + 2 * iByte), _mm256_permute2x128_si256(first, second, 0x20));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_ + 2 * iByte + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+#endif
+#if LOGGER_USE_SSE2
+    const __m128i nibbleMask128 = _mm_set1_epi8(0x0f);
+    for( ; iByte + 16 <= size_ ; iByte += 16 ){
+      __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + iByte));
+      __m128i high = getHexDigitsSse2(_mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask128));
+      __m128i low = getHexDigitsSse2(_mm_and_si128(bytes, nibbleMask128));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out_ + 2 * iByte), _mm_unpacklo_epi8(high, low));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out_ + 2 * iByte + 16), _mm_unpackhi_epi8(high, low));
+    }
+#endif
+    static const char hexDigits[] = "0123456789abcdef";
+    for( ; iByte < size_ ; iByte++ ){
+      out_[2 * iByte] = hexDigits[in[iByte] >> 4];
+      out_[2 * iByte + 1] = hexDigits[in[iByte] & 0x0f];
+    }
+  }
+  inline void encodePrintable(const void* data_, size_t size_, char* out_){
+    // printable: 0x20 to 0x7e. As signed bytes, 0x80-0xff are negative so one compare on each side is enough.
+    const uint8_t* in = static_cast<const uint8_t*>(data_);
+    size_t iByte{0};
+#if LOGGER_USE_AVX2
+    for( ; iByte + 32 <= size_ ; iByte += 32 ){
+      __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + iByte));
+      __m256i isPrintable = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(0x1f)), _mm256_cmpgt_epi8(_mm256_set1_epi8(0x7f), bytes));
+      __m256i result = _mm256_or_si256(_mm256_and_si256(isPrintable, bytes), _mm256_andnot_si256(isPrintable, _mm256_set1_epi8('.')));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_ + iByte), result);
+    }
+#endif
+#if LOGGER_USE_SSE2
+    for( ; iByte + 16 <= size_ ; iByte += 16 ){
+      __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + iByte));
+      __m128i isPrintable = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x1f)), _mm_cmplt_epi8(bytes, _mm_set1_epi8(0x7f)));
+      __m128i result = _mm_or_si128(_mm_and_si128(isPrintable, bytes), _mm_andnot_si128(isPrintable, _mm_set1_epi8('.')));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out_ + iByte), result);
+    }
+#endif
+    for( ; iByte < size_ ; iByte++ ){
+      out_[iByte] = ( in[iByte] >= 0x20 and in[iByte] < 0x7f ? char(in[iByte]) : '.' );
+    }
+  }
+
+  inline void formatHexDump(std::string& out_, const void* data_, size_t size_, size_t maxBytes_){
+    const size_t rowSize{16};
+    size_t nBytes = std::min(size_, maxBytes_);
+    if( nBytes == 0 and size_ == 0 ) return;
+
+    // the whole buffer goes through the kernels at once, the rows are then assembled right into out_
+    std::string digitStr(2 * nBytes, '\0');
+    std::string printableStr(nBytes, '\0');
+    encodeHex(data_, nBytes, &digitStr[0]);
+    encodePrintable(data_, nBytes, &printableStr[0]);
+
+    // "<offset>  hh hh hh hh hh hh hh hh  hh hh hh hh hh hh hh hh  |<ascii>|"
+    const int nOffsetDigits = ( nBytes > 0xffffffffULL ? 16 : 8 );
+    const size_t maxRowLength = size_t(nOffsetDigits) + 2 + 3 * rowSize + 1 + 1 + rowSize + 2 + 1; // with '\n'
+    size_t nRows = (nBytes + rowSize - 1) / rowSize;
+    size_t outBegin = out_.size();
+    out_.resize(outBegin + nRows * maxRowLength);
+    char* c = &out_[outBegin];
+
+    static const char hexDigits[] = "0123456789abcdef";
+    for( size_t iRow = 0 ; iRow < nRows ; iRow++ ){
+      size_t offset = iRow * rowSize;
+      size_t nRowBytes = std::min(rowSize, nBytes - offset);
+      if( iRow != 0 ){ *c++ = '\n'; }
+      for( int iDigit = 0 ; iDigit < nOffsetDigits ; iDigit++ ){
+        *c++ = hexDigits[(static_cast<unsigned long long>(offset) >> (4 * (nOffsetDigits - 1 - iDigit))) & 0x0f];
+      }
+      *c++ = ' ';
+      *c++ = ' ';
+      for( size_t iByte = 0 ; iByte < rowSize ; iByte++ ){
+        if( iByte < nRowBytes ){ std::memcpy(c, &digitStr[2 * (offset + iByte)], 2); }
+        else{ c[0] = ' '; c[1] = ' '; } // aligned ASCII column on the last row
+        c[2] = ' ';
+        c += 3;
+        if( iByte + 1 == rowSize / 2 ){ *c++ = ' '; }
+      }
+      *c++ = ' ';
+      *c++ = '|';
+      std::memcpy(c, &printableStr[offset], nRowBytes);
+      c += nRowBytes;
+      *c++ = '|';
+    }
+    out_.resize(size_t(c - &out_[0]));
+
+    if( nBytes < size_ ){
+      if( nRows != 0 ){ out_ += '\n'; }
+      out_ += "... (+";
+      out_ += std::to_string(size_ - nBytes);
+      out_ += " bytes)";
+    }
+  }
+  inline std::string getHexDumpStr(const void* data_, size_t size_, size_t maxBytes_){
+    std::string out;
+    formatHexDump(out, data_, size_, maxBytes_);
+    return out;
+  }
+  inline std::ostream& operator<<(std::ostream& stream_, const HexView& hexView_){
+    std::string str;
+    formatHexDump(str, hexView_.data, hexView_.size, hexView_.maxBytes);
+    return stream_ << str;
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERHEX_IMPL_H
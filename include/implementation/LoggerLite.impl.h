@@ -0,0 +1,179 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERLITE_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERLITE_IMPL_H
+
+// Compiled in a single source file (LOGGER_LITE_IMPLEMENTATION): nothing is inline here
+
+#include <cstdio>
+#include <cstdarg>
+#include <cstring>
+#include <streambuf>
+
+
+namespace LoggerLite{
+
+  class PayloadStreamBuffer : public std::streambuf{
+    // lets the types printable with std::ostream write right into the line
+  public:
+    explicit PayloadStreamBuffer(std::string& str_) : _str_(str_) {}
+
+  protected:
+    int_type overflow(int_type c_) override {
+      if( not traits_type::eq_int_type(c_, traits_type::eof()) ){ _str_ += traits_type::to_char_type(c_); }
+      return traits_type::not_eof(c_);
+    }
+    std::streamsize xsputn(const char* str_, std::streamsize size_) override {
+      _str_.append(str_, size_t(size_));
+      return size_;
+    }
+
+  private:
+    std::string& _str_;
+  };
+
+  struct LineAccess{
+    static Logger::LogLevel getLogLevel(const Line& line_){
+      return ( line_._isActive_ and not Logger::isMuted() ) ? static_cast<Logger::LogLevel>(line_._logLevel_) : Logger::LogLevel::INVALID;
+    }
+    static const char* getFileName(const Line& line_){
+      // as FILENAME, without the folders
+      const char* lastSlash = std::strrchr(line_._filePath_, '/');
+      return ( lastSlash != nullptr ? lastSlash + 1 : line_._filePath_ );
+    }
+    static void print(Line& line_, Logger& logger_){
+      // the line jumps (std::endl included) are in the payload: the Logger reprints the prefix by itself
+      if( not line_._payload_.empty() ){ logger_ << line_._payload_; }
+      line_._isActive_ = false;
+    }
+    static void dispatch(Line& line_){
+      Logger logger{LineAccess::getLogLevel(line_), LineAccess::getFileName(line_), line_._lineNumber_, line_._isOnce_};
+      LineAccess::print(line_, logger);
+    }
+    [[noreturn]] static void throwError(Line& line_, const char* conditionStr_){
+      Logger logger{LineAccess::getLogLevel(line_), LineAccess::getFileName(line_), line_._lineNumber_};
+      LineAccess::print(line_, logger);
+      logger << std::endl;
+      Logger::throwError(conditionStr_); // the logger is still locked, as with Logger.h
+    }
+    [[noreturn]] static void triggerExit(Line& line_, const char* conditionStr_){
+      Logger logger{LineAccess::getLogLevel(line_), LineAccess::getFileName(line_), line_._lineNumber_};
+      LineAccess::print(line_, logger);
+      logger << std::endl;
+      Logger::triggerExit(conditionStr_);
+    }
+  };
+
+  // Line
+  Line::Line(int logLevel_, const char* filePath_, int lineNumber_, bool isPrint_, bool isOnce_) :
+      _filePath_(filePath_),
+      _lineNumber_(lineNumber_),
+      _logLevel_(logLevel_),
+      _isActive_(isPrint_ and not Logger::isMuted() and logLevel_ <= Logger::getMaxLogLevelInt()),
+      _isOnce_(isOnce_) {}
+  Line::~Line(){
+    if( _isActive_ ){ LineAccess::dispatch(*this); }
+  }
+
+  Line& Line::operator<<(const char* str_){
+    if( _isActive_ and str_ != nullptr ){ _payload_ += str_; }
+    return *this;
+  }
+  Line& Line::operator<<(const std::string& str_){
+    if( _isActive_ ){ _payload_ += str_; }
+    return *this;
+  }
+  Line& Line::operator<<(char value_){
+    if( _isActive_ ){ _payload_ += value_; }
+    return *this;
+  }
+  Line& Line::operator<<(bool value_){
+    if( _isActive_ ){ _payload_ += ( value_ ? '1' : '0' ); } // as std::ostream
+    return *this;
+  }
+  Line& Line::operator<<(short value_){ return (*this) << int(value_); }
+  Line& Line::operator<<(unsigned short value_){ return (*this) << static_cast<unsigned int>(value_); }
+  Line& Line::operator<<(int value_){
+    if( _isActive_ ){ _payload_ += std::to_string(value_); }
+    return *this;
+  }
+  Line& Line::operator<<(unsigned int value_){
+    if( _isActive_ ){ _payload_ += std::to_string(value_); }
+    return *this;
+  }
+  Line& Line::operator<<(long value_){
+    if( _isActive_ ){ _payload_ += std::to_string(value_); }
+    return *this;
+  }
+  Line& Line::operator<<(unsigned long value_){
+    if( _isActive_ ){ _payload_ += std::to_string(value_); }
+    return *this;
+  }
+  Line& Line::operator<<(long long value_){
+    if( _isActive_ ){ _payload_ += std::to_string(value_); }
+    return *this;
+  }
+  Line& Line::operator<<(unsigned long long value_){
+    if( _isActive_ ){ _payload_ += std::to_string(value_); }
+    return *this;
+  }
+  Line& Line::operator<<(float value_){ return (*this) << double(value_); }
+  Line& Line::operator<<(double value_){
+    if( _isActive_ ){
+      char buffer[32];
+      int size = std::snprintf(buffer, sizeof(buffer), "%g", value_); // default std::ostream formatting
+      if( size > 0 ){ _payload_.append(buffer, size_t(size)); }
+    }
+    return *this;
+  }
+  Line& Line::operator<<(const void* ptr_){
+    if( _isActive_ ){ this->appendStreamed(&streamValue<const void*>, &ptr_); }
+    return *this;
+  }
+  Line& Line::operator<<(std::ostream& (*f_)(std::ostream&)){
+    // std::flush and others: the line is sent by the destructor anyway
+    if( _isActive_ and f_ == static_cast<std::ostream& (*)(std::ostream&)>(std::endl) ){ _payload_ += '\n'; }
+    return *this;
+  }
+  void Line::operator()(const char* fmtStr_, ...){
+    if( not _isActive_ ){ return; }
+    va_list argList;
+    va_start(argList, fmtStr_);
+    va_list argListCopy;
+    va_copy(argListCopy, argList);
+    int size = std::vsnprintf(nullptr, 0, fmtStr_, argListCopy);
+    va_end(argListCopy);
+    if( size > 0 ){
+      size_t offset = _payload_.size();
+      _payload_.resize(offset + size_t(size) + 1);
+      std::vsnprintf(&_payload_[offset], size_t(size) + 1, fmtStr_, argList);
+      _payload_.resize(offset + size_t(size));
+    }
+    va_end(argList);
+    // as Logger.h: a line jump is added if not already there
+    if( _payload_.empty() or _payload_.back() != '\n' ){ _payload_ += '\n'; }
+  }
+  Line& Line::operator()(bool condition_){
+    if( not condition_ ){ _isActive_ = false; }
+    return *this;
+  }
+  void Line::appendStreamed(void (*streamFct_)(std::ostream&, const void*), const void* data_){
+    PayloadStreamBuffer streamBuffer{_payload_};
+    std::ostream stream{&streamBuffer};
+    streamFct_(stream, data_);
+  }
+
+  // Assertions
+  void throwError(Line& line_, const char* conditionStr_){ LineAccess::throwError(line_, conditionStr_); }
+  void triggerExit(Line& line_, const char* conditionStr_){ LineAccess::triggerExit(line_, conditionStr_); }
+
+  // Settings
+  void setMaxLogLevel(int maxLogLevel_){ Logger::setMaxLogLevel(maxLogLevel_); }
+  int getMaxLogLevel(){ return Logger::getMaxLogLevelInt(); }
+  void setIsMuted(bool isMuted_){ Logger::setIsMuted(isMuted_); }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERLITE_IMPL_H
@@ -18,12 +18,30 @@
 #endif // HAS_CPP_11
 
 
+// branch hints and outlining of the error paths (LogThrowIf, LogAssert...)
+#if defined(__GNUC__) || defined(__clang__)
+#define LOGGER_LIKELY(x) __builtin_expect(!!(x), 1)
+#define LOGGER_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#define LOGGER_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define LOGGER_LIKELY(x) (x)
+#define LOGGER_UNLIKELY(x) (x)
+#define LOGGER_COLD __declspec(noinline)
+#else
+#define LOGGER_LIKELY(x) (x)
+#define LOGGER_UNLIKELY(x) (x)
+#define LOGGER_COLD
+#endif
+
+
 #define CAT_(a, b) a ## b
 #define CAT(a, b) CAT_(a, b)
 #define MAKE_VARNAME_LINE(Var) CAT(Var, __LINE__)
 
 
-#define LogDispatcher( logLevel_, isPrint_, isOnce_ )  (Logger{((!(isPrint_) || Logger::isMuted()) ? Logger::LogLevel::INVALID : logLevel_), FILENAME, __LINE__, isOnce_})
+#define LogDispatcher( logLevel_, isPrint_, isOnce_ )  (Logger{((!(isPrint_) || Logger::isMuted()) ? Logger::LogLevel::INVALID : logLevel_), FILENAME, __LINE__, isOnce_, LogFilterSiteImpl})
+// static state of the call site, for the runtime filters (a lambda: the macros are expressions)
+#define LogFilterSiteImpl ([]() -> LoggerUtils::LogFilterSite* { static LoggerUtils::LogFilterSite site; return &site; }())
 
 #define LogFatalImpl( isPrint_, isOnce_)     (LogDispatcher(Logger::LogLevel::FATAL,   isPrint_, isOnce_))
 #define LogErrorImpl( isPrint_, isOnce_ )     (LogDispatcher(Logger::LogLevel::ERROR,   isPrint_, isOnce_))
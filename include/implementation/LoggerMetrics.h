@@ -0,0 +1,105 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+#include "LoggerTimers.h"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+// Values aggregated per interval instead of printed (see LogStat): count, min, max, mean and last value of each stat
+namespace LoggerUtils{
+
+  class MetricAccumulator{
+    // Only written by its owner thread: relaxed atomics keep concurrent reads well-defined.
+    // Two slots, one per interval parity: a dump reads the closed interval while the owner starts filling the next one.
+  public:
+    inline void add(double value_, uint64_t nowNs_, uint64_t interval_);
+    inline bool mergeInto(uint64_t interval_, uint64_t& count_, double& sum_, double& min_, double& max_, double& last_, uint64_t& lastNs_) const;
+
+  private:
+    struct Slot{
+      std::atomic<uint64_t> interval{UINT64_MAX};
+      std::atomic<uint64_t> count{0};
+      std::atomic<double> sum{0};
+      std::atomic<double> min{0};
+      std::atomic<double> max{0};
+      std::atomic<double> last{0};
+      std::atomic<uint64_t> lastNs{0};
+    };
+    Slot _slotList_[2]{};
+  };
+
+  struct MetricSummary{
+    std::string name{};
+    std::string fileName{}; // of the first LogStat call feeding it, for the prefix
+    int lineNumber{-1};
+    uint64_t count{0};
+    double mean{0};
+    double min{0};
+    double max{0};
+    double last{0};
+  };
+
+  class MetricRegistry{
+    // Shared by all the source files
+  public:
+    inline MetricRegistry();
+
+    inline size_t registerSite(const std::string& name_, const char* fileName_, int lineNumber_);
+    inline MetricAccumulator* createThreadAccumulator(size_t siteId_);
+    inline void releaseThreadAccumulators(const std::vector<MetricAccumulator*>& accumulatorList_); // thread exit: reused by the next threads
+
+    uint64_t getInterval() const { return _interval_.load(std::memory_order_relaxed); }
+    inline std::vector<MetricSummary> closeInterval(double& elapsedSeconds_); // summaries of the stats updated since the last call
+
+    // periodic dump
+    inline void setDumpInterval(double seconds_);
+    inline bool isDumpDue(uint64_t nowNs_) const { return _dumpIntervalNs_.load(std::memory_order_relaxed) != 0 and nowNs_ >= _nextDumpNs_.load(std::memory_order_relaxed); }
+    inline bool claimDump(uint64_t nowNs_); // only one thread wins
+    void setDumpPending(){ _isDumpPending_.store(true, std::memory_order_relaxed); } // printed at the end of the next print statement
+    bool claimPendingDump(){ return _isDumpPending_.load(std::memory_order_relaxed) and _isDumpPending_.exchange(false); }
+
+  private:
+    struct SiteEntry{
+      std::string name;
+      std::string fileName;
+      int lineNumber;
+    };
+    struct AccumulatorEntry{
+      size_t siteId;
+      std::unique_ptr<MetricAccumulator> accumulator; // kept after the thread exits, with its values
+    };
+
+    std::mutex _mutex_{};
+    std::vector<SiteEntry> _siteList_{};
+    std::vector<AccumulatorEntry> _accumulatorList_{};
+    std::vector<std::vector<MetricAccumulator*>> _freeAccumulatorList_{}; // per site, released by the exited threads
+    std::atomic<uint64_t> _interval_{0};
+    uint64_t _intervalStartNs_;
+    std::atomic<uint64_t> _dumpIntervalNs_{0};
+    std::atomic<uint64_t> _nextDumpNs_{0};
+    std::atomic<bool> _isDumpPending_{false};
+  };
+  inline MetricRegistry& getMetricRegistry(){ static MetricRegistry registry; return registry; }
+
+  struct MetricSite{
+    // One static instance per LogStat call
+    MetricSite(const char* name_, const char* fileName_, int lineNumber_) : id(getMetricRegistry().registerSite(name_, fileName_, lineNumber_)) {}
+    const size_t id;
+  };
+
+  inline MetricAccumulator& getThreadMetricAccumulator(const MetricSite& site_);
+
+}
+
+#include "LoggerMetrics.impl.h"
@@ -0,0 +1,134 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERMETRICS_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERMETRICS_IMPL_H
+
+#include <algorithm>
+
+
+namespace LoggerUtils{
+
+  // MetricAccumulator
+  inline void MetricAccumulator::add(double value_, uint64_t nowNs_, uint64_t interval_){
+    auto& slot = _slotList_[interval_ & 1];
+    if( slot.interval.load(std::memory_order_relaxed) != interval_ ){
+      // first value of this thread in the interval: the slot still holds the one before the previous
+      slot.count.store(1, std::memory_order_relaxed);
+      slot.sum.store(value_, std::memory_order_relaxed);
+      slot.min.store(value_, std::memory_order_relaxed);
+      slot.max.store(value_, std::memory_order_relaxed);
+      slot.last.store(value_, std::memory_order_relaxed);
+      slot.lastNs.store(nowNs_, std::memory_order_relaxed);
+      slot.interval.store(interval_, std::memory_order_release);
+      return;
+    }
+    slot.count.store(slot.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    slot.sum.store(slot.sum.load(std::memory_order_relaxed) + value_, std::memory_order_relaxed);
+    if( value_ < slot.min.load(std::memory_order_relaxed) ) slot.min.store(value_, std::memory_order_relaxed);
+    if( value_ > slot.max.load(std::memory_order_relaxed) ) slot.max.store(value_, std::memory_order_relaxed);
+    slot.last.store(value_, std::memory_order_relaxed);
+    slot.lastNs.store(nowNs_, std::memory_order_relaxed);
+  }
+  inline bool MetricAccumulator::mergeInto(uint64_t interval_, uint64_t& count_, double& sum_, double& min_, double& max_, double& last_, uint64_t& lastNs_) const {
+    auto& slot = _slotList_[interval_ & 1];
+    if( slot.interval.load(std::memory_order_acquire) != interval_ ) return false; // not updated by this thread during the interval
+
+    uint64_t count = slot.count.load(std::memory_order_relaxed);
+    if( count == 0 ) return false;
+    double min = slot.min.load(std::memory_order_relaxed);
+    double max = slot.max.load(std::memory_order_relaxed);
+    min_ = ( count_ == 0 ? min : std::min(min_, min) );
+    max_ = ( count_ == 0 ? max : std::max(max_, max) );
+    count_ += count;
+    sum_ += slot.sum.load(std::memory_order_relaxed);
+    uint64_t lastNs = slot.lastNs.load(std::memory_order_relaxed);
+    if( lastNs >= lastNs_ ){ lastNs_ = lastNs; last_ = slot.last.load(std::memory_order_relaxed); }
+    return true;
+  }
+
+  // MetricRegistry
+  inline MetricRegistry::MetricRegistry() : _intervalStartNs_(getMonotonicTimeNs()) {
+    this->setDumpInterval(LOGGER_METRICS_DUMP_INTERVAL);
+  }
+  inline size_t MetricRegistry::registerSite(const std::string& name_, const char* fileName_, int lineNumber_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    // several call sites can feed the same stat
+    for( size_t iSite = 0 ; iSite < _siteList_.size() ; iSite++ ){
+      if( _siteList_[iSite].name == name_ ) return iSite;
+    }
+    _siteList_.push_back({name_, fileName_, lineNumber_});
+    return _siteList_.size() - 1;
+  }
+  inline MetricAccumulator* MetricRegistry::createThreadAccumulator(size_t siteId_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( siteId_ < _freeAccumulatorList_.size() and not _freeAccumulatorList_[siteId_].empty() ){
+      // the values of the exited thread in the current interval are extended, not lost
+      MetricAccumulator* accumulator = _freeAccumulatorList_[siteId_].back();
+      _freeAccumulatorList_[siteId_].pop_back();
+      return accumulator;
+    }
+    _accumulatorList_.push_back({siteId_, std::unique_ptr<MetricAccumulator>(new MetricAccumulator())});
+    return _accumulatorList_.back().accumulator.get();
+  }
+  inline void MetricRegistry::releaseThreadAccumulators(const std::vector<MetricAccumulator*>& accumulatorList_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( _freeAccumulatorList_.size() < accumulatorList_.size() ) _freeAccumulatorList_.resize(accumulatorList_.size());
+    for( size_t iSite = 0 ; iSite < accumulatorList_.size() ; iSite++ ){
+      if( accumulatorList_[iSite] != nullptr ) _freeAccumulatorList_[iSite].push_back(accumulatorList_[iSite]);
+    }
+  }
+  inline std::vector<MetricSummary> MetricRegistry::closeInterval(double& elapsedSeconds_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+
+    // the next values go to the other slot. A value added while switching may be missed: fine for monitoring.
+    uint64_t interval = _interval_.load(std::memory_order_relaxed);
+    _interval_.store(interval + 1, std::memory_order_relaxed);
+    uint64_t nowNs = getMonotonicTimeNs();
+    elapsedSeconds_ = double(nowNs - _intervalStartNs_) / 1E9;
+    _intervalStartNs_ = nowNs;
+
+    std::vector<MetricSummary> out(_siteList_.size());
+    std::vector<double> sumPerSite(_siteList_.size(), 0);
+    std::vector<uint64_t> lastNsPerSite(_siteList_.size(), 0);
+    for( auto& entry : _accumulatorList_ ){
+      auto& summary = out[entry.siteId];
+      entry.accumulator->mergeInto(interval, summary.count, sumPerSite[entry.siteId], summary.min, summary.max, summary.last, lastNsPerSite[entry.siteId]);
+    }
+    for( size_t iSite = 0 ; iSite < out.size() ; iSite++ ){
+      out[iSite].name = _siteList_[iSite].name;
+      out[iSite].fileName = _siteList_[iSite].fileName;
+      out[iSite].lineNumber = _siteList_[iSite].lineNumber;
+      if( out[iSite].count != 0 ) out[iSite].mean = sumPerSite[iSite] / double(out[iSite].count);
+    }
+
+    out.erase(std::remove_if(out.begin(), out.end(), [](const MetricSummary& s_){ return s_.count == 0; }), out.end());
+    return out;
+  }
+  inline void MetricRegistry::setDumpInterval(double seconds_){
+    auto intervalNs = static_cast<uint64_t>(seconds_ > 0 ? seconds_ * 1E9 : 0);
+    _dumpIntervalNs_.store(intervalNs, std::memory_order_relaxed);
+    _nextDumpNs_.store(getMonotonicTimeNs() + intervalNs, std::memory_order_relaxed);
+  }
+  inline bool MetricRegistry::claimDump(uint64_t nowNs_){
+    auto nextDump = _nextDumpNs_.load(std::memory_order_relaxed);
+    if( nowNs_ < nextDump ) return false;
+    return _nextDumpNs_.compare_exchange_strong(nextDump, nowNs_ + _dumpIntervalNs_.load(std::memory_order_relaxed));
+  }
+
+  inline MetricAccumulator& getThreadMetricAccumulator(const MetricSite& site_){
+    struct ThreadAccumulators{
+      std::vector<MetricAccumulator*> list;
+      ~ThreadAccumulators(){ getMetricRegistry().releaseThreadAccumulators(list); }
+    };
+    static thread_local ThreadAccumulators accumulators;
+    auto& accumulatorList = accumulators.list;
+    if( site_.id >= accumulatorList.size() ) accumulatorList.resize(site_.id + 1, nullptr);
+    if( accumulatorList[site_.id] == nullptr ) accumulatorList[site_.id] = getMetricRegistry().createThreadAccumulator(site_.id);
+    return *accumulatorList[site_.id];
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERMETRICS_IMPL_H
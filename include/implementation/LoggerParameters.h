@@ -26,7 +26,115 @@
 #endif
 
 #ifndef LOGGER_PREFIX_FORMAT
-#define LOGGER_PREFIX_FORMAT "{TIME} {USER_HEADER} {SEVERITY} {FILELINE} {THREAD}"
+#define LOGGER_PREFIX_FORMAT "{TIME} {USER_HEADER} {SEVERITY} {FILELINE} {THREAD} {CONTEXT}"
+#endif
+
+#ifndef LOGGER_RESOURCE_SAMPLING_PERIOD
+#define LOGGER_RESOURCE_SAMPLING_PERIOD 500 // ms between two readings of the {RSS} and {CPU} prefix tokens
+#endif
+
+#ifndef LOGGER_INDENT_TABLE_SIZE
+#define LOGGER_INDENT_TABLE_SIZE 64 // max indentation depth (2 spaces each)
+#endif
+
+#ifndef LOGGER_PROGRESS_REFRESH_RATE
+#define LOGGER_PROGRESS_REFRESH_RATE 10 // max redraws per second of a LogProgress bar
+#endif
+
+#ifndef LOGGER_PROGRESS_PLAIN_PERIOD
+#define LOGGER_PROGRESS_PLAIN_PERIOD 5 // seconds between LogProgress lines when stdout is not a terminal
+#endif
+
+#ifndef LOGGER_RANGE_MAX_ELEMENTS
+#define LOGGER_RANGE_MAX_ELEMENTS 32 // elements printed by LogRange(container) before eliding the rest
+#endif
+
+#ifndef LOGGER_HEX_MAX_BYTES
+#define LOGGER_HEX_MAX_BYTES 4096 // bytes printed by LogHex(data, size) before eliding the rest
+#endif
+
+#ifndef LOGGER_METRICS_DUMP_INTERVAL
+#define LOGGER_METRICS_DUMP_INTERVAL 10 // seconds between two summaries of the LogStat values (0: only with Logger::dumpMetrics())
+#endif
+
+#ifndef LOGGER_PAYLOAD_SANITIZING
+#define LOGGER_PAYLOAD_SANITIZING 0 // default of the sinks for untrusted text: 0: written as is, 1: escaped ("\x1b"), 2: stripped
+#endif
+
+#ifndef LOGGER_COLLAPSE_REPEATED_LINES
+#define LOGGER_COLLAPSE_REPEATED_LINES 0 // print "previous message repeated N times" instead of identical lines
+#endif
+
+#ifndef LOGGER_COLLAPSE_REPEATED_WINDOW
+#define LOGGER_COLLAPSE_REPEATED_WINDOW 10 // seconds: max time span covered by one "repeated" line
+#endif
+
+#ifndef LOGGER_SYSLOG_SOCKET_PATH
+#define LOGGER_SYSLOG_SOCKET_PATH "/dev/log"
+#endif
+
+#ifndef LOGGER_SYSLOG_FACILITY
+#define LOGGER_SYSLOG_FACILITY (1 << 3) // LOG_USER
+#endif
+
+#ifndef LOGGER_SYSLOG_BATCH_SIZE
+#define LOGGER_SYSLOG_BATCH_SIZE 64 // lines sent by a single sendmmsg() call
+#endif
+
+#ifndef LOGGER_SYSLOG_FLUSH_PERIOD
+#define LOGGER_SYSLOG_FLUSH_PERIOD 0.2 // seconds after which a partial batch is sent anyway
+#endif
+
+#ifndef LOGGER_SYSLOG_MAX_MESSAGE_SIZE
+#define LOGGER_SYSLOG_MAX_MESSAGE_SIZE 8192 // longer lines are truncated
+#endif
+
+#ifndef LOGGER_SHARED_RING_SIZE
+#define LOGGER_SHARED_RING_SIZE 4194304 // bytes of the shared memory ring (see LoggerUtils::SharedRingSink)
+#endif
+
+#ifndef LOGGER_ASYNC_CONSOLE
+#define LOGGER_ASYNC_CONSOLE 0 // the console is written by a background thread (see LoggerUtils::AsyncSink)
+#endif
+
+#ifndef LOGGER_ASYNC_MAX_BACKLOG_SIZE
+#define LOGGER_ASYNC_MAX_BACKLOG_SIZE 4194304 // bytes waiting to be written before the low severity lines get dropped
+#endif
+
+#ifndef LOGGER_ASYNC_DROP_REPORT_PERIOD
+#define LOGGER_ASYNC_DROP_REPORT_PERIOD 10 // seconds between two "line(s) dropped" reports
+#endif
+
+#ifndef LOGGER_ENABLE_STATS
+#define LOGGER_ENABLE_STATS 1 // self-telemetry counters, see Logger::getStats() (0: compiled out)
+#endif
+
+#ifndef LOGGER_STATS_REPORT_INTERVAL
+#define LOGGER_STATS_REPORT_INTERVAL 0 // seconds between two "[Logger] stats" lines (0: never)
+#endif
+
+#ifndef LOGGER_STATS_FILE
+#define LOGGER_STATS_FILE "" // Prometheus text file rewritten every LOGGER_STATS_FILE_INTERVAL seconds ("": none)
+#endif
+
+#ifndef LOGGER_STATS_FILE_INTERVAL
+#define LOGGER_STATS_FILE_INTERVAL 15
+#endif
+
+#ifndef LOGGER_ENABLE_STACK_TRACE
+#define LOGGER_ENABLE_STACK_TRACE 0 // call stack of Logger::throwError() and LogFatal. Requires -ldl with glibc < 2.34, -rdynamic for the names of the executable's functions
+#endif
+
+#ifndef LOGGER_STACK_TRACE_MAX_DEPTH
+#define LOGGER_STACK_TRACE_MAX_DEPTH 32 // frames recorded
+#endif
+
+#ifndef LOGGER_ENABLE_ASSERT_DEBUG
+#ifdef NDEBUG
+#define LOGGER_ENABLE_ASSERT_DEBUG 0 // LogAssertDebug is compiled out in release builds
+#else
+#define LOGGER_ENABLE_ASSERT_DEBUG 1
+#endif
 #endif
 
 #ifndef LOGGER_CLEAR_LINE_BEFORE_PRINT
@@ -45,4 +153,70 @@
 #define LOGGER_OUTFILE_FOLDER "."
 #endif
 
+#ifndef LOGGER_OUTFILE_COMPRESSION
+#define LOGGER_OUTFILE_COMPRESSION 0 // 0: none, 1: gzip (requires LOGGER_ENABLE_ZLIB), 2: zstd (requires LOGGER_ENABLE_ZSTD)
+#endif
+
+#ifndef LOGGER_OUTFILE_COMPRESSION_BLOCK_SIZE
+#define LOGGER_OUTFILE_COMPRESSION_BLOCK_SIZE 1048576 // bytes compressed at once, each block ends with a flush point
+#endif
+
+#ifndef LOGGER_OUTFILE_COMPRESSION_FLUSH_PERIOD
+#define LOGGER_OUTFILE_COMPRESSION_FLUSH_PERIOD 5 // seconds after which a partial block is compressed and written anyway
+#endif
+
+#ifndef LOGGER_WRITE_SHARD_OUTFILES
+#define LOGGER_WRITE_SHARD_OUTFILES 0 // one file per thread, see Logger::setWriteInShardFiles
+#endif
+
+#ifndef LOGGER_SHARD_OUTFILE_NAME_FORMAT
+#define LOGGER_SHARD_OUTFILE_NAME_FORMAT "{EXE}_{TIME}_t{TID}.log"
+#endif
+
+#ifndef LOGGER_SHARD_BUFFER_SIZE
+#define LOGGER_SHARD_BUFFER_SIZE 65536 // bytes buffered per thread before writing to the shard
+#endif
+
+#ifndef LOGGER_WRITE_BINARY_OUTFILE
+#define LOGGER_WRITE_BINARY_OUTFILE 0
+#endif
+
+#ifndef LOGGER_BINARY_OUTFILE_NAME_FORMAT
+#define LOGGER_BINARY_OUTFILE_NAME_FORMAT "{EXE}_{TIME}.blog"
+#endif
+
+#ifndef LOGGER_BINARY_BLOCK_SIZE
+#define LOGGER_BINARY_BLOCK_SIZE 65536 // uncompressed bytes per block (= granularity of the index)
+#endif
+
+#ifndef LOGGER_BINARY_FLUSH_PERIOD
+#define LOGGER_BINARY_FLUSH_PERIOD 5 // seconds after which a partial block is written anyway
+#endif
+
+#ifndef LOGGER_ENABLE_SIMD
+#define LOGGER_ENABLE_SIMD 1 // SSE2/AVX2 code paths when the target supports them (0: scalar code only)
+#endif
+
+#ifndef LOGGER_ENABLE_ZLIB
+#define LOGGER_ENABLE_ZLIB 0 // requires linking against zlib (-lz)
+#endif
+
+#ifndef LOGGER_ENABLE_ZSTD
+#define LOGGER_ENABLE_ZSTD 0 // requires linking against zstd (-lzstd)
+#endif
+
+
+// derived from the parameters above
+#if LOGGER_ENABLE_SIMD && defined(__AVX2__)
+#define LOGGER_USE_AVX2 1
+#else
+#define LOGGER_USE_AVX2 0
+#endif
+
+#if LOGGER_ENABLE_SIMD && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define LOGGER_USE_SSE2 1
+#else
+#define LOGGER_USE_SSE2 0
+#endif
+
 #endif //SIMPLE_CPP_LOGGER_LOGGERPARAMETERS_H
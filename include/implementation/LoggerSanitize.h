@@ -0,0 +1,36 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+
+// Sanitization of untrusted text (data read from files, sockets, user inputs...) before it reaches a terminal or a file.
+// Unsafe: the control characters but '\t' (ESC starts the terminal escape sequences), DEL and the UTF-8 C1 controls (U+0080 to U+009F).
+namespace LoggerUtils{
+
+  enum class PayloadSanitizing{
+    NONE = 0, // written as is
+    ESCAPE,   // written as "\x1b", "\u009b"...
+    STRIP     // removed, with the whole escape sequence they start
+  };
+
+  // index of the first byte to sanitize, size_ if there is none. Vectorized (AVX2, SSE2 or scalar, chosen at compile time):
+  // clean text goes through at memory bandwidth. The lead byte 0xc2 of U+0080 to U+00BF is reported as well.
+  inline size_t findUnsafeChar(const char* data_, size_t size_);
+  inline bool isSafeStr(const std::string& str_){ return findUnsafeChar(str_.data(), str_.size()) == str_.size(); }
+
+  // the safe parts are appended in bulk: only the unsafe bytes take the slow path
+  inline void appendSanitized(std::string& out_, const char* data_, size_t size_, PayloadSanitizing sanitizing_);
+  inline std::string getSanitizedStr(const std::string& str_, PayloadSanitizing sanitizing_);
+
+}
+
+#include "LoggerSanitize.impl.h"
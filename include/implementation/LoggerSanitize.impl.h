@@ -0,0 +1,141 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERSANITIZE_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERSANITIZE_IMPL_H
+
+#if LOGGER_USE_AVX2
+#include <immintrin.h>
+#endif
+#if LOGGER_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace LoggerUtils{
+
+  inline bool isUnsafeChar(uint8_t c_){
+    return ( c_ < 0x20 and c_ != '\t' ) or c_ == 0x7f or c_ == 0xc2;
+  }
+  inline int getLowestBitIndex(uint32_t mask_){
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask_);
+#else
+    int index{0};
+    while( not (mask_ & 1u) ){ mask_ >>= 1; index++; }
+    return index;
+#endif
+  }
+
+  // Kernels: unsigned "c <= 0x1f" is min(c, 0x1f) == c, so that the UTF-8 bytes (>= 0x80) are not taken as negative
+  inline size_t findUnsafeChar(const char* data_, size_t size_){
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(data_);
+    size_t iByte{0};
+#if LOGGER_USE_AVX2
+    const __m256i controlMax = _mm256_set1_epi8(0x1f);
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i del = _mm256_set1_epi8(0x7f);
+    const __m256i c1Lead = _mm256_set1_epi8(char(0xc2));
+    for( ; iByte + 32 <= size_ ; iByte += 32 ){
+      __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + iByte));
+      __m256i isControl = _mm256_andnot_si256(_mm256_cmpeq_epi8(bytes, tab), _mm256_cmpeq_epi8(_mm256_min_epu8(bytes, controlMax), bytes));
+      __m256i isUnsafe = _mm256_or_si256(isControl, _mm256_or_si256(_mm256_cmpeq_epi8(bytes, del), _mm256_cmpeq_epi8(bytes, c1Lead)));
+      auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(isUnsafe));
+      if( mask != 0 ) return iByte + size_t(getLowestBitIndex(mask));
+    }
+#endif
+#if LOGGER_USE_SSE2
+    const __m128i controlMax128 = _mm_set1_epi8(0x1f);
+    const __m128i tab128 = _mm_set1_epi8('\t');
+    const __m128i del128 = _mm_set1_epi8(0x7f);
+    const __m128i c1Lead128 = _mm_set1_epi8(char(0xc2));
+    for( ; iByte + 16 <= size_ ; iByte += 16 ){
+      __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + iByte));
+      __m128i isControl = _mm_andnot_si128(_mm_cmpeq_epi8(bytes, tab128), _mm_cmpeq_epi8(_mm_min_epu8(bytes, controlMax128), bytes));
+      __m128i isUnsafe = _mm_or_si128(isControl, _mm_or_si128(_mm_cmpeq_epi8(bytes, del128), _mm_cmpeq_epi8(bytes, c1Lead128)));
+      auto mask = static_cast<uint32_t>(_mm_movemask_epi8(isUnsafe));
+      if( mask != 0 ) return iByte + size_t(getLowestBitIndex(mask));
+    }
+#endif
+    for( ; iByte < size_ ; iByte++ ){
+      if( isUnsafeChar(in[iByte]) ) return iByte;
+    }
+    return size_;
+  }
+
+  inline size_t getEscapeSequenceSize(const uint8_t* data_, size_t size_){
+    // bytes of the sequence starting with ESC (data_[0]), or with the 8-bit CSI (U+009B, 2 bytes)
+    size_t iByte{1};
+    bool isCsi{false};
+    if( data_[0] == 0xc2 ){ iByte = 2; isCsi = true; }
+    else if( size_ > 1 and data_[1] == '[' ){ iByte = 2; isCsi = true; }
+    else if( size_ > 1 and data_[1] == ']' ){
+      // OSC (window title, hyperlinks...): ends with BEL or ESC '\'
+      for( iByte = 2 ; iByte < size_ ; iByte++ ){
+        if( data_[iByte] == '\a' ) return iByte + 1;
+        if( data_[iByte] == 0x1b ) return ( iByte + 1 < size_ and data_[iByte + 1] == '\\' ? iByte + 2 : iByte );
+      }
+      return size_;
+    }
+    else if( size_ > 1 and data_[1] >= 0x20 and data_[1] < 0x7f ){ return 2; } // ESC 'c', ESC '(' ...
+
+    if( isCsi ){
+      // parameters and intermediate bytes, then the final byte in [@-~]
+      while( iByte < size_ and data_[iByte] >= 0x20 and data_[iByte] < '@' ){ iByte++; }
+      if( iByte < size_ and data_[iByte] >= '@' and data_[iByte] <= '~' ){ iByte++; }
+    }
+    return iByte;
+  }
+
+  inline void appendSanitized(std::string& out_, const char* data_, size_t size_, PayloadSanitizing sanitizing_){
+    if( sanitizing_ == PayloadSanitizing::NONE ){ out_.append(data_, size_); return; }
+
+    static const char hexDigits[] = "0123456789abcdef";
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(data_);
+    size_t iByte{0};
+    while( iByte < size_ ){
+      size_t iUnsafe = iByte + findUnsafeChar(data_ + iByte, size_ - iByte);
+      out_.append(data_ + iByte, iUnsafe - iByte);
+      if( iUnsafe == size_ ) break;
+
+      uint8_t c = in[iUnsafe];
+      bool isC1 = ( c == 0xc2 and iUnsafe + 1 < size_ and in[iUnsafe + 1] >= 0x80 and in[iUnsafe + 1] <= 0x9f );
+      if( c == 0xc2 and not isC1 ){
+        // regular character: U+00A0 to U+00BF
+        out_ += char(c);
+        iByte = iUnsafe + 1;
+        continue;
+      }
+
+      if( sanitizing_ == PayloadSanitizing::ESCAPE ){
+        if( isC1 ){
+          out_ += "\\u00";
+          out_ += hexDigits[in[iUnsafe + 1] >> 4];
+          out_ += hexDigits[in[iUnsafe + 1] & 0x0f];
+          iByte = iUnsafe + 2;
+        }
+        else{
+          out_ += "\\x";
+          out_ += hexDigits[c >> 4];
+          out_ += hexDigits[c & 0x0f];
+          iByte = iUnsafe + 1;
+        }
+        continue;
+      }
+
+      // STRIP: the parameters of an escape sequence would be left as garbage ("[31m")
+      if( c == 0x1b or (isC1 and in[iUnsafe + 1] == 0x9b) ){ iByte = iUnsafe + getEscapeSequenceSize(in + iUnsafe, size_ - iUnsafe); }
+      else{ iByte = iUnsafe + ( isC1 ? 2 : 1 ); }
+    }
+  }
+  inline std::string getSanitizedStr(const std::string& str_, PayloadSanitizing sanitizing_){
+    std::string out;
+    out.reserve(str_.size());
+    appendSanitized(out, str_.data(), str_.size(), sanitizing_);
+    return out;
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERSANITIZE_IMPL_H
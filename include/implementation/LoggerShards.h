@@ -0,0 +1,68 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+#include "LoggerUtils.h"
+#include "LoggerSinks.h"
+
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+
+// Per-thread output files (see Logger::setWriteInShardFiles): each thread writes its own file without any lock.
+// Each line starts with "<sequence number> <timestamp in ns> ", so tools/LoggerShardMerge can restore the global order.
+namespace LoggerUtils{
+
+  class ShardFileRegistry{
+    // Shared by all the source files. Only touched when a shard is opened or closed, not when a line is written.
+  public:
+    inline void enable(const std::string& pathFormat_); // "{TID}" is replaced by the thread number
+    inline void disable(){ _isEnabled_.store(false, std::memory_order_relaxed); }
+    bool isEnabled() const { return _isEnabled_.load(std::memory_order_relaxed); }
+
+    uint64_t getNextSequenceNumber(){ return _sequenceNumber_.fetch_add(1, std::memory_order_relaxed); }
+
+    inline std::FILE* openShard(uint32_t threadNumber_);
+    inline void closeShard(std::FILE* file_);
+    inline void flushAll(); // from any thread: stdio streams have their own lock
+
+  private:
+    std::atomic<bool> _isEnabled_{false};
+    std::atomic<uint64_t> _sequenceNumber_{0};
+
+    std::mutex _mutex_{};
+    std::string _pathFormat_{};
+    std::vector<std::FILE*> _fileList_{};
+  };
+  inline ShardFileRegistry& getShardFileRegistry(){ static ShardFileRegistry registry; return registry; }
+
+  class ShardFileWriter{
+    // One per thread, the file is opened with the first line
+  public:
+    ShardFileWriter() = default;
+    ShardFileWriter(const ShardFileWriter&) = delete;
+    ShardFileWriter& operator=(const ShardFileWriter&) = delete;
+    ~ShardFileWriter(){ close(); }
+
+    inline void write(const LogRecord& record_);
+    inline void close();
+
+  private:
+    std::FILE* _file_{nullptr};
+    bool _isOpenFailed_{false};
+    LogRecord _pendingRecord_{}; // pieces of line are gathered to write one keyed line
+    std::vector<char> _buffer_{};
+  };
+  inline ShardFileWriter& getThreadShardFileWriter(){ static thread_local ShardFileWriter writer; return writer; }
+
+}
+
+#include "LoggerShards.impl.h"
@@ -0,0 +1,81 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERSHARDS_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERSHARDS_IMPL_H
+
+#include <algorithm>
+
+
+namespace LoggerUtils{
+
+  // ShardFileRegistry
+  inline void ShardFileRegistry::enable(const std::string& pathFormat_){
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      // the shards already opened keep their path: only set once
+      if( _pathFormat_.empty() ) _pathFormat_ = pathFormat_;
+    }
+    _isEnabled_.store(true, std::memory_order_relaxed);
+  }
+  inline std::FILE* ShardFileRegistry::openShard(uint32_t threadNumber_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    std::string filePath{_pathFormat_};
+    replaceSubstringInsideInputString(filePath, "{TID}", std::to_string(threadNumber_));
+    std::FILE* file = std::fopen(filePath.c_str(), "w");
+    if( file != nullptr ) _fileList_.emplace_back(file);
+    return file;
+  }
+  inline void ShardFileRegistry::closeShard(std::FILE* file_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    _fileList_.erase(std::remove(_fileList_.begin(), _fileList_.end(), file_), _fileList_.end());
+    std::fclose(file_);
+  }
+  inline void ShardFileRegistry::flushAll(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    for( auto* file : _fileList_ ){ std::fflush(file); }
+  }
+
+  // ShardFileWriter
+  inline void ShardFileWriter::write(const LogRecord& record_){
+    if( _pendingRecord_.payload.empty() ){
+      _pendingRecord_.logLevel = record_.logLevel;
+      _pendingRecord_.timestamp = record_.timestamp;
+    }
+    _pendingRecord_.payload += record_.getRenderedStr(false);
+    if( record_.terminator == '\0' ) return;
+
+    if( _file_ == nullptr and not _isOpenFailed_ ){
+      _file_ = getShardFileRegistry().openShard(getThreadIdentity().number);
+      _isOpenFailed_ = ( _file_ == nullptr );
+      if( _file_ != nullptr ){
+        _buffer_.resize(LOGGER_SHARD_BUFFER_SIZE);
+        std::setvbuf(_file_, _buffer_.data(), _IOFBF, _buffer_.size());
+      }
+    }
+    if( _file_ == nullptr ){ _pendingRecord_.clear(); return; }
+
+    // '\r' lines (progress bars) become regular lines
+    std::string& line = _pendingRecord_.payload;
+    if( not line.empty() and (line.back() == '\n' or line.back() == '\r') ) line.back() = '\n';
+    else line += '\n';
+
+    char keyBuffer[48];
+    int keySize = std::snprintf(keyBuffer, sizeof(keyBuffer), "%llu %llu ",
+                                static_cast<unsigned long long>(getShardFileRegistry().getNextSequenceNumber()),
+                                static_cast<unsigned long long>(_pendingRecord_.timestamp));
+    std::fwrite(keyBuffer, 1, size_t(keySize), _file_);
+    std::fwrite(line.data(), 1, line.size(), _file_);
+    if( _pendingRecord_.logLevel <= 1 ) std::fflush(_file_); // ERROR and FATAL lines are on disk right away
+    _pendingRecord_.clear();
+  }
+  inline void ShardFileWriter::close(){
+    if( _file_ == nullptr ) return;
+    getShardFileRegistry().closeShard(_file_);
+    _file_ = nullptr;
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERSHARDS_IMPL_H
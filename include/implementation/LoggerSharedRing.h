@@ -0,0 +1,100 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+
+#include <atomic>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+
+// Shared memory ring (POSIX shm_open + mmap), written by the logged process and drained by an external consumer
+// (see tools/LoggerRingConsumer.cpp). Layout of the shared object:
+//  - SharedRingHeader
+//  - capacity bytes of data (power of 2), as a sequence of [SharedRingEntryHeader + rendered line], 8 bytes aligned
+// Single producer / single consumer: the sinks are written under the dispatcher lock, so one process = one producer.
+// The producer never waits: when the consumer is slow or gone, the lines which don't fit are counted as overruns.
+namespace LoggerUtils{
+
+  struct SharedRingHeader{
+    char magic[8];
+    uint32_t version;
+    uint32_t capacity;      // bytes of data
+    int64_t producerPid;    // lets the consumer know when the producer is gone
+    // positions only increase, the offset in the data is pos & (capacity - 1)
+    alignas(64) std::atomic<uint64_t> writePos; // producer side
+    std::atomic<uint64_t> nOverruns;            // lines dropped by the producer
+    alignas(64) std::atomic<uint64_t> readPos;  // consumer side
+  };
+  struct SharedRingEntryHeader{
+    static const uint32_t wrapMarker = 0xFFFFFFFF;
+
+    uint32_t length;        // text size in bytes, wrapMarker: the next entry starts at the beginning of the data
+    uint8_t level;
+    uint8_t reserved[3];
+    uint64_t timestamp;     // ns since epoch
+  };
+
+#if !defined(_WIN32)
+  class SharedRingWriter{
+  public:
+    SharedRingWriter() = default;
+    SharedRingWriter(const SharedRingWriter&) = delete;
+    SharedRingWriter& operator=(const SharedRingWriter&) = delete;
+    ~SharedRingWriter(){ close(); }
+
+    // Creates the shared object, or takes over an existing ring with the same capacity.
+    // The object is kept after close() so the consumer can drain it: the consumer removes it.
+    inline bool open(const std::string& name_, uint32_t capacity_ = LOGGER_SHARED_RING_SIZE);
+    inline void close();
+
+    // returns false (and counts an overrun) if the line doesn't fit in the free space
+    inline bool write(int logLevel_, uint64_t timestamp_, const char* data_, size_t size_);
+
+    bool isOpen() const { return _header_ != nullptr; }
+    const std::string& getName() const { return _name_; }
+    inline uint64_t getNbOverruns() const;
+
+  private:
+    std::string _name_{};
+    SharedRingHeader* _header_{nullptr};
+    char* _data_{nullptr};
+    size_t _mappedSize_{0};
+  };
+
+  class SharedRingReader{
+  public:
+    SharedRingReader() = default;
+    SharedRingReader(const SharedRingReader&) = delete;
+    SharedRingReader& operator=(const SharedRingReader&) = delete;
+    ~SharedRingReader(){ close(); }
+
+    inline bool open(const std::string& name_);
+    inline void close();
+
+    // Calls func_(logLevel, timestamp, data, size) for each available line, returns the number of lines read
+    inline size_t read(const std::function<void(int, uint64_t, const char*, size_t)>& func_);
+
+    bool isOpen() const { return _header_ != nullptr; }
+    inline bool isProducerAlive() const;
+    inline uint64_t getNbOverruns() const;
+
+  private:
+    SharedRingHeader* _header_{nullptr};
+    const char* _data_{nullptr};
+    size_t _mappedSize_{0};
+  };
+#endif
+
+  inline size_t getSharedRingEntrySize(size_t length_); // header + text, 8 bytes aligned
+  inline std::string getSharedRingObjectName(const std::string& name_); // "name" -> "/name", as expected by shm_open()
+
+}
+
+#include "LoggerSharedRing.impl.h"
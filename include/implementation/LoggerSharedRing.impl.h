@@ -0,0 +1,202 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERSHAREDRING_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERSHAREDRING_IMPL_H
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+namespace LoggerUtils{
+
+  namespace SharedRingConstants{
+    static const char magic[8] = {'S','C','L','R','I','N','G','1'};
+    static const uint32_t version = 1;
+    static const size_t dataOffset = (sizeof(SharedRingHeader) + 63) & ~size_t(63);
+  }
+
+  inline size_t getSharedRingEntrySize(size_t length_){ return (sizeof(SharedRingEntryHeader) + length_ + 7) & ~size_t(7); }
+  inline std::string getSharedRingObjectName(const std::string& name_){ return ( name_.empty() or name_[0] != '/' ? "/" + name_ : name_ ); }
+
+#if !defined(_WIN32)
+  // Writer
+  inline bool SharedRingWriter::open(const std::string& name_, uint32_t capacity_){
+    if( this->isOpen() ) return true;
+
+    // power of 2, large enough for a few lines
+    uint32_t capacity{4096};
+    while( capacity < capacity_ and capacity < (1u << 31) ){ capacity <<= 1; }
+
+    int fd = ::shm_open(getSharedRingObjectName(name_).c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0600);
+    if( fd < 0 ) return false;
+
+    size_t mappedSize = SharedRingConstants::dataOffset + capacity;
+    struct stat fileStat{};
+    bool isExisting = ( ::fstat(fd, &fileStat) == 0 and size_t(fileStat.st_size) == mappedSize );
+    if( not isExisting and ::ftruncate(fd, off_t(mappedSize)) != 0 ){ ::close(fd); return false; }
+
+    void* address = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if( address == MAP_FAILED ) return false;
+    auto* header = static_cast<SharedRingHeader*>(address);
+
+    isExisting = isExisting
+        and std::memcmp(header->magic, SharedRingConstants::magic, sizeof(header->magic)) == 0
+        and header->version == SharedRingConstants::version and header->capacity == capacity;
+    if( isExisting ){
+      std::atomic_thread_fence(std::memory_order_acquire);
+      // single producer: don't steal the ring of a running process
+      auto previousPid = static_cast<pid_t>(header->producerPid);
+      if( previousPid > 0 and previousPid != ::getpid() and (::kill(previousPid, 0) == 0 or errno == EPERM) ){ ::munmap(address, mappedSize); return false; }
+      // the lines left by the previous producer are kept for the consumer
+    }
+    else{
+      std::memset(header->magic, 0, sizeof(header->magic)); // not valid until initialized
+      header->version = SharedRingConstants::version;
+      header->capacity = capacity;
+      header->writePos.store(0, std::memory_order_relaxed);
+      header->readPos.store(0, std::memory_order_relaxed);
+      header->nOverruns.store(0, std::memory_order_relaxed);
+    }
+    header->producerPid = ::getpid();
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header->magic, SharedRingConstants::magic, sizeof(header->magic));
+
+    _name_ = name_;
+    _header_ = header;
+    _data_ = static_cast<char*>(address) + SharedRingConstants::dataOffset;
+    _mappedSize_ = mappedSize;
+    return true;
+  }
+  inline void SharedRingWriter::close(){
+    if( not this->isOpen() ) return;
+    ::munmap(_header_, _mappedSize_);
+    _header_ = nullptr;
+    _data_ = nullptr;
+  }
+  inline bool SharedRingWriter::write(int logLevel_, uint64_t timestamp_, const char* data_, size_t size_){
+    if( not this->isOpen() ) return false;
+    const uint64_t capacity = _header_->capacity;
+
+    // a line never takes more than a quarter of the ring
+    size_t maxLength = size_t(capacity / 4) - sizeof(SharedRingEntryHeader);
+    if( size_ > maxLength ) size_ = maxLength;
+    uint64_t entrySize = getSharedRingEntrySize(size_);
+
+    uint64_t writePos = _header_->writePos.load(std::memory_order_relaxed); // only written here
+    uint64_t readPos = _header_->readPos.load(std::memory_order_acquire);
+    uint64_t offset = writePos & (capacity - 1);
+    uint64_t tailRoom = capacity - offset;
+    uint64_t skipped = ( tailRoom < entrySize ? tailRoom : 0 ); // entries are contiguous
+
+    if( writePos + skipped + entrySize - readPos > capacity ){
+      _header_->nOverruns.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    if( skipped != 0 ){
+      // tailRoom is 8 bytes aligned: there is always room for the length
+      uint32_t wrapMarker = SharedRingEntryHeader::wrapMarker;
+      std::memcpy(_data_ + offset, &wrapMarker, sizeof(wrapMarker));
+      writePos += skipped;
+      offset = 0;
+    }
+
+    SharedRingEntryHeader entryHeader{};
+    entryHeader.length = static_cast<uint32_t>(size_);
+    entryHeader.level = static_cast<uint8_t>(logLevel_);
+    entryHeader.timestamp = timestamp_;
+    std::memcpy(_data_ + offset, &entryHeader, sizeof(entryHeader));
+    std::memcpy(_data_ + offset + sizeof(entryHeader), data_, size_);
+
+    _header_->writePos.store(writePos + entrySize, std::memory_order_release);
+    return true;
+  }
+  inline uint64_t SharedRingWriter::getNbOverruns() const {
+    return ( this->isOpen() ? _header_->nOverruns.load(std::memory_order_relaxed) : 0 );
+  }
+
+  // Reader
+  inline bool SharedRingReader::open(const std::string& name_){
+    if( this->isOpen() ) return true;
+
+    int fd = ::shm_open(getSharedRingObjectName(name_).c_str(), O_RDWR | O_CLOEXEC, 0600);
+    if( fd < 0 ) return false;
+
+    struct stat fileStat{};
+    if( ::fstat(fd, &fileStat) != 0 or size_t(fileStat.st_size) <= SharedRingConstants::dataOffset ){ ::close(fd); return false; }
+    auto mappedSize = size_t(fileStat.st_size);
+
+    void* address = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if( address == MAP_FAILED ) return false;
+
+    auto* header = static_cast<SharedRingHeader*>(address);
+    if( std::memcmp(header->magic, SharedRingConstants::magic, sizeof(header->magic)) != 0
+        or header->version != SharedRingConstants::version
+        or SharedRingConstants::dataOffset + header->capacity != mappedSize ){
+      // not initialized yet, or not a ring
+      ::munmap(address, mappedSize);
+      return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    _header_ = header;
+    _data_ = static_cast<const char*>(address) + SharedRingConstants::dataOffset;
+    _mappedSize_ = mappedSize;
+    return true;
+  }
+  inline void SharedRingReader::close(){
+    if( not this->isOpen() ) return;
+    ::munmap(_header_, _mappedSize_);
+    _header_ = nullptr;
+    _data_ = nullptr;
+  }
+  inline size_t SharedRingReader::read(const std::function<void(int, uint64_t, const char*, size_t)>& func_){
+    if( not this->isOpen() ) return 0;
+    const uint64_t capacity = _header_->capacity;
+
+    size_t nLines{0};
+    uint64_t readPos = _header_->readPos.load(std::memory_order_relaxed); // only written here
+    uint64_t writePos = _header_->writePos.load(std::memory_order_acquire);
+    while( readPos < writePos ){
+      uint64_t offset = readPos & (capacity - 1);
+      SharedRingEntryHeader entryHeader{};
+      std::memcpy(&entryHeader.length, _data_ + offset, sizeof(entryHeader.length));
+      if( entryHeader.length == SharedRingEntryHeader::wrapMarker ){
+        readPos += capacity - offset;
+        continue;
+      }
+      std::memcpy(&entryHeader, _data_ + offset, sizeof(entryHeader));
+      func_(entryHeader.level, entryHeader.timestamp, _data_ + offset + sizeof(entryHeader), entryHeader.length);
+      readPos += getSharedRingEntrySize(entryHeader.length);
+      nLines++;
+    }
+    // the space is handed back to the producer once the lines have been processed
+    _header_->readPos.store(readPos, std::memory_order_release);
+    return nLines;
+  }
+  inline bool SharedRingReader::isProducerAlive() const {
+    if( not this->isOpen() ) return false;
+    auto pid = static_cast<pid_t>(_header_->producerPid);
+    return ( pid > 0 and (::kill(pid, 0) == 0 or errno == EPERM) );
+  }
+  inline uint64_t SharedRingReader::getNbOverruns() const {
+    return ( this->isOpen() ? _header_->nOverruns.load(std::memory_order_relaxed) : 0 );
+  }
+#endif
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERSHAREDRING_IMPL_H
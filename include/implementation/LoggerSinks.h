@@ -0,0 +1,389 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+#include "LoggerBinaryFormat.h"
+#include "LoggerSharedRing.h"
+#include "LoggerCompression.h"
+#include "LoggerTimers.h"
+#include "LoggerSanitize.h"
+#include "LoggerStats.h"
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <functional>
+#include <condition_variable>
+
+
+namespace LoggerUtils{
+
+  struct LogRecord{
+    // One line printed by the logger (or a piece of it if the print statement did not end the line).
+    // Colored and plain renderings are built once, and the same bytes are handed to every sink.
+    int logLevel{0};
+    int lineNumber{-1};
+    uint32_t threadId{0};
+    uint32_t threadSlot{0};            // see ThreadIdentity::slot
+    uint64_t timestamp{0};             // ns since epoch
+    bool enableColors{false};          // colors requested by the source file which printed the line
+    bool isLineStart{false};           // starts a line: carries the prefix, which is empty with PrefixLevel::NONE
+    char terminator{'\0'};             // '\n', '\r' or '\0' if the line continues in the next record
+    const char* payloadColor{nullptr}; // color applied to the whole payload (FATAL)
+    std::string fileName{};
+    std::string coloredPrefix{};
+    std::string plainPrefix{};
+    std::string payload{};
+
+    inline const std::string& getRenderedStr(bool enableColors_) const;
+    // with the payload sanitized: the regular rendering if it is clean, otherwise rendered in buffer_
+    inline const std::string& getRenderedStr(bool enableColors_, PayloadSanitizing sanitizing_, std::string& buffer_) const;
+    inline const std::string& getPayload(PayloadSanitizing sanitizing_, std::string& buffer_) const;
+    inline bool isPayloadSafe() const; // scanned once for all the sinks
+    inline size_t getRenderedSize(bool enableColors_) const; // without rendering
+    inline bool empty() const { return coloredPrefix.empty() and payload.empty() and terminator == '\0'; }
+    inline void clear();
+
+  private:
+    inline void render(std::string& out_, bool isColored_, PayloadSanitizing sanitizing_) const;
+
+    mutable bool _isColoredStrRendered_{false};
+    mutable bool _isPlainStrRendered_{false};
+    mutable bool _isPayloadChecked_{false};
+    mutable bool _isPayloadSafe_{false};
+    mutable std::string _coloredStr_{};
+    mutable std::string _plainStr_{};
+  };
+
+  class LogSink{
+  public:
+    virtual ~LogSink() = default;
+
+    virtual void write(const LogRecord& record_) = 0;
+    virtual void writeBlock(const std::vector<LogRecord>& recordList_){ for( auto& record : recordList_ ){ this->write(record); } } // lines of a Logger::Block
+    virtual void writeTerminalCommand(const std::string& /*command_*/){} // cursor moves, line clearing...
+    virtual void flush(){}
+    virtual void sync(){ this->flush(); } // returns once everything has been written (exit, uncaught exception...)
+    virtual uint64_t getNbDroppedLines() const { return 0; } // lines which could not be written, see Logger::getStats()
+
+    // Usage: sink->setMaxLogLevel(Logger::LogLevel::INFO);
+    template<typename LogLevelT> void setMaxLogLevel(LogLevelT maxLogLevel_){ _maxLogLevel_ = static_cast<int>(maxLogLevel_); }
+    void setEnableColors(bool enableColors_){ _enableColors_ = enableColors_; } // colors and terminal control codes
+    void setPayloadSanitizing(PayloadSanitizing sanitizing_){ _payloadSanitizing_ = sanitizing_; } // for untrusted text, the prefix is kept
+
+    int getMaxLogLevel() const { return _maxLogLevel_; }
+    bool isEnableColors() const { return _enableColors_; }
+    PayloadSanitizing getPayloadSanitizing() const { return _payloadSanitizing_; }
+    bool isAccepting(const LogRecord& record_) const { return record_.logLevel <= _maxLogLevel_; }
+
+  protected:
+    // rendering of the record for this sink (colors, sanitization). Valid until the next call.
+    const std::string& getRenderedStr(const LogRecord& record_){ return record_.getRenderedStr(_enableColors_, _payloadSanitizing_, _sanitizedStr_); }
+    const std::string& getPayload(const LogRecord& record_){ return record_.getPayload(_payloadSanitizing_, _sanitizedStr_); }
+    inline void renderBlock(const std::vector<LogRecord>& recordList_, std::string& out_);
+
+    int _maxLogLevel_{std::numeric_limits<int>::max()}; // everything printed by the logger
+    bool _enableColors_{false};
+    PayloadSanitizing _payloadSanitizing_{static_cast<PayloadSanitizing>(LOGGER_PAYLOAD_SANITIZING)};
+    std::string _sanitizedStr_{}; // reused: no allocation in steady state
+  };
+
+  class OStreamSink : public LogSink{
+    // std::cout, std::cerr...
+  public:
+    explicit OStreamSink(std::ostream& stream_, bool enableColors_ = true) : _stream_(&stream_) { _enableColors_ = enableColors_; }
+
+    inline void write(const LogRecord& record_) override;
+    inline void writeBlock(const std::vector<LogRecord>& recordList_) override; // in one write
+    inline void writeTerminalCommand(const std::string& command_) override;
+    void flush() override { _stream_->flush(); }
+
+  private:
+    std::ostream* _stream_;
+  };
+
+  class FileSink : public LogSink{
+    // Text file. Colors are disabled by default
+  public:
+    FileSink() = default;
+    explicit FileSink(const std::string& filePath_){ open(filePath_); }
+
+    bool open(const std::string& filePath_){ _filePath_ = filePath_; _fileStream_.open(filePath_); return _fileStream_.is_open(); }
+    bool isOpen() const { return _fileStream_.is_open(); }
+    const std::string& getFilePath() const { return _filePath_; }
+
+    inline void write(const LogRecord& record_) override;
+    inline void writeBlock(const std::vector<LogRecord>& recordList_) override; // in one write
+    void flush() override { _fileStream_.flush(); }
+
+  private:
+    std::string _filePath_{};
+    std::ofstream _fileStream_{};
+  };
+
+  class CompressedFileSink : public LogSink{
+    // Text file (.gz, .zst) compressed on the fly by a background thread, by blocks of LOGGER_OUTFILE_COMPRESSION_BLOCK_SIZE bytes.
+    // A partial block is also compressed after LOGGER_OUTFILE_COMPRESSION_FLUSH_PERIOD seconds: a truncated file stays readable
+    // up to the last block. The logging threads only wait if the compression falls behind by several blocks.
+  public:
+    inline explicit CompressedFileSink(const std::string& filePath_, StreamCodec codec_ = static_cast<StreamCodec>(LOGGER_OUTFILE_COMPRESSION),
+                                       size_t blockSize_ = LOGGER_OUTFILE_COMPRESSION_BLOCK_SIZE);
+    inline ~CompressedFileSink() override;
+
+    bool isOpen() const { return _fileStream_.is_open(); }
+    const std::string& getFilePath() const { return _filePath_; }
+    StreamCodec getCodec() const { return _compressor_.getCodec(); }
+
+    inline void write(const LogRecord& record_) override;
+    void flush() override {} // called at each std::endl: the blocks are closed by size or time
+    inline void sync() override;
+
+  private:
+    static const size_t maxPendingBlocks = 4;
+
+    inline void compressionLoop();
+
+    std::string _filePath_;
+    size_t _blockSize_;
+    std::ofstream _fileStream_{};
+    StreamCompressor _compressor_{}; // compression thread only, once started
+
+    std::mutex _mutex_{};
+    std::condition_variable _wakeUpCondition_{};
+    std::condition_variable _drainedCondition_{};
+    std::string _currentBlock_{};
+    uint64_t _currentBlockStartNs_{0};
+    std::vector<std::string> _pendingBlockList_{};
+    std::vector<std::string> _freeBlockList_{}; // recycled buffers
+    bool _isSyncRequested_{false};
+    bool _isStopping_{false};
+
+    std::thread _compressionThread_{};
+  };
+
+  class BinaryFileSink : public LogSink{
+    // Indexed binary file, see LoggerBinaryFormat.h. Blocks are written once full, or by a background thread
+    // after LOGGER_BINARY_FLUSH_PERIOD seconds: one index entry per block, not per line.
+  public:
+    BinaryFileSink() = default;
+    inline explicit BinaryFileSink(const std::string& filePath_);
+    inline ~BinaryFileSink() override;
+
+    bool isOpen() const { return _writer_.isOpen(); }
+    const std::string& getFilePath() const { return _writer_.getFilePath(); }
+
+    inline void write(const LogRecord& record_) override;
+    void flush() override {} // called at each std::endl: the blocks are closed by size or time
+    void sync() override { _writer_.flush(); }
+
+  private:
+    inline void flushLoop();
+
+    BinaryLogWriter _writer_{};
+    LogRecord _pendingRecord_{}; // pieces of line are gathered to write one record per line
+
+    std::mutex _mutex_{};
+    std::condition_variable _stopCondition_{};
+    bool _isStopping_{false};
+    std::thread _flushThread_{};
+  };
+
+#if !defined(_WIN32)
+  class SyslogSink : public LogSink{
+    // Datagrams sent to the local log daemon (syslog, journald) with the priority of each line.
+    // Lines are sent by batches: sendmmsg() once LOGGER_SYSLOG_BATCH_SIZE are pending, or by a background thread
+    // after LOGGER_SYSLOG_FLUSH_PERIOD seconds.
+  public:
+    inline explicit SyslogSink(const std::string& ident_ = "", const std::string& socketPath_ = LOGGER_SYSLOG_SOCKET_PATH, int facility_ = LOGGER_SYSLOG_FACILITY);
+    inline ~SyslogSink() override;
+
+    bool isConnected() const { return _socket_ >= 0; }
+
+    inline void write(const LogRecord& record_) override;
+    void flush() override {} // called at each std::endl: the batches are sent by size or time
+    inline void sync() override;
+
+    inline static int getSyslogPriority(int logLevel_); // FATAL -> LOG_CRIT, ..., TRACE -> LOG_DEBUG
+
+  private:
+    inline bool connectSocket();
+    inline void sendBatch(); // with _mutex_ held
+    inline void flushLoop();
+
+    std::string _ident_;
+    std::string _socketPath_;
+    int _facility_;
+    int _socket_{-1};
+
+    LogRecord _pendingRecord_{};              // pieces of line are gathered to send one datagram per line
+    std::vector<std::string> _messageList_{}; // reused: no allocation in steady state
+    size_t _nbMessages_{0};
+    uint64_t _batchStartNs_{0};
+
+    std::mutex _mutex_{};
+    std::condition_variable _stopCondition_{};
+    bool _isStopping_{false};
+    std::thread _flushThread_{};
+  };
+
+  class SharedRingSink : public LogSink{
+    // Rendered lines copied into a shared memory ring, drained by another process (tools/LoggerRingConsumer).
+    // No system call while logging, and never blocking: lines which don't fit are counted as overruns.
+  public:
+    explicit SharedRingSink(const std::string& name_, uint32_t capacity_ = LOGGER_SHARED_RING_SIZE){ _writer_.open(name_, capacity_); }
+
+    bool isOpen() const { return _writer_.isOpen(); }
+    uint64_t getNbOverruns() const { return _writer_.getNbOverruns(); }
+    uint64_t getNbDroppedLines() const override { return this->getNbOverruns(); }
+
+    inline void write(const LogRecord& record_) override;
+
+  private:
+    SharedRingWriter _writer_{};
+    LogRecord _pendingRecord_{}; // pieces of line are gathered to write one entry per line
+  };
+#endif
+
+  class AsyncSink : public LogSink{
+    // Writes through a background thread: logging threads never wait on a stalled output (full pipe, paused terminal...).
+    // Once the backlog exceeds its budget, TRACE/DEBUG/INFO lines are dropped, then WARNING/ALERT past twice the budget.
+    // ERROR and FATAL lines are always kept. Dropped lines are reported periodically by a summary line.
+  public:
+    inline explicit AsyncSink(std::shared_ptr<LogSink> sink_, size_t maxBacklogSize_ = LOGGER_ASYNC_MAX_BACKLOG_SIZE);
+    inline ~AsyncSink() override;
+
+    inline void write(const LogRecord& record_) override;
+    inline void writeTerminalCommand(const std::string& command_) override;
+    inline void flush() override; // doesn't wait
+    inline void sync() override;
+
+    const std::shared_ptr<LogSink>& getSink() const { return _sink_; }
+    inline uint64_t getNbDroppedLines() const override;
+    inline uint64_t getNbDroppedLines(int logLevel_) const;
+
+  private:
+    struct Entry{
+      bool isTerminalCommand{false};
+      LogRecord record{};
+      std::string terminalCommand{};
+    };
+    static const int nLogLevels = 8;
+
+    inline bool isDropping(const LogRecord& record_) const;
+    inline void writerLoop();
+    inline void reportDroppedLines();
+
+    std::shared_ptr<LogSink> _sink_;
+    const size_t _maxBacklogSize_;
+
+    std::mutex _mutex_{};
+    std::condition_variable _wakeUpCondition_{};
+    std::condition_variable _drainedCondition_{};
+    std::vector<Entry> _pendingList_{};
+    size_t _backlogSize_{0}; // bytes
+    bool _isWriting_{false};
+    bool _isStopping_{false};
+    std::vector<uint32_t> _droppingLineList_{}; // per thread slot: number + 1 of the thread whose line is being dropped (the rest goes too), or 0
+
+    std::atomic<uint64_t> _nbDroppedList_[nLogLevels]{};
+    uint64_t _nbReportedList_[nLogLevels]{}; // writer thread only
+    uint64_t _nextReportNs_{0};
+
+    std::thread _writerThread_{};
+  };
+
+  class RepeatedLineFilter{
+    // Collapses the consecutive identical lines printed by a given thread from the same call site
+    // into "previous message repeated N times". Only whole lines (printed at once) are considered.
+  public:
+    void setWindow(uint64_t windowNs_){ _windowNs_ = windowNs_; }
+
+    // returns false if the record is a repetition, which should not be written
+    template<typename WriteFunc> inline bool process(const LogRecord& record_, WriteFunc write_);
+    template<typename WriteFunc> inline void releaseExpired(uint64_t timestamp_, WriteFunc write_); // lazy timeout check
+    template<typename WriteFunc> inline void releaseAll(WriteFunc write_);
+    uint64_t getNextExpiry() const { return _nextExpiry_; } // timestamp of the first pending summary due
+
+  private:
+    struct ThreadState{
+      bool isValid{false};
+      size_t hash{0};
+      uint64_t nRepeats{0};
+      uint64_t windowEnd{0};
+      LogRecord lastRecord{}; // metadata and prefix of the last repetition
+    };
+
+    inline static size_t getHash(const LogRecord& record_);
+    inline static bool isSameLine(const LogRecord& a_, const LogRecord& b_);
+    template<typename WriteFunc> inline void releaseState(ThreadState& state_, WriteFunc write_);
+
+    uint64_t _windowNs_{0};
+    uint64_t _nextExpiry_{std::numeric_limits<uint64_t>::max()};
+    std::vector<ThreadState> _stateList_{}; // indexed by thread slot
+    LogRecord _summaryRecord_{};
+  };
+
+  class LogSinkDispatcher{
+    // Shared by all the source files of the process
+  public:
+    inline LogSinkDispatcher();
+    inline ~LogSinkDispatcher();
+
+    inline void addSink(const std::shared_ptr<LogSink>& sink_, const std::string& name_ = "");
+    inline void removeSink(const std::string& name_);
+    inline void removeSink(const std::shared_ptr<LogSink>& sink_);
+    inline void clearSinks();
+    inline std::shared_ptr<LogSink> getSink(const std::string& name_);
+    template<typename SinkFactory> inline std::shared_ptr<LogSink> getOrAddSink(const std::string& name_, SinkFactory factory_);
+    inline std::shared_ptr<LogSink> replaceSink(const std::string& name_, const std::shared_ptr<LogSink>& sink_); // returns the previous one
+
+    inline void dispatch(const LogRecord& record_);
+    inline void dispatchBlock(const std::vector<LogRecord>& recordList_); // written to each sink without other lines in between
+    inline void dispatchTerminalCommand(const std::string& command_);
+    inline void flush();
+    inline void sync();
+
+    inline void setCollapseRepeatedLines(bool collapseRepeatedLines_);
+
+    inline LoggerStats getStats(); // per-thread counters merged, with the ones of the sinks
+
+  private:
+    struct SinkEntry{
+      std::string name;
+      std::shared_ptr<LogSink> sink;
+      uint64_t nbRecords;
+      uint64_t nbBytes;
+    };
+
+    inline void writeToSinks(const LogRecord& record_);
+    inline void writeStatsOutputs(); // periodic summary line and stats file, when due
+    inline void expiryLoop(); // "repeated" lines of the threads which went quiet
+
+    std::mutex _mutex_{};
+    std::vector<SinkEntry> _sinkEntryList_{};
+    bool _collapseRepeatedLines_{LOGGER_COLLAPSE_REPEATED_LINES};
+    RepeatedLineFilter _repeatedLineFilter_{};
+    uint64_t _nbCollapsedLines_{0};
+
+    std::condition_variable _expiryCondition_{};
+    bool _isStopping_{false};
+    std::thread _expiryThread_{}; // started with the collapsing
+  };
+
+  inline LogSinkDispatcher& getLogSinkDispatcher(){ static LogSinkDispatcher dispatcher; return dispatcher; }
+
+}
+
+#include "LoggerSinks.impl.h"
@@ -0,0 +1,849 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERSINKS_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERSINKS_IMPL_H
+
+#include "LoggerMacros.h"
+
+#include <ctime>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/uio.h>
+#include <sys/socket.h>
+#endif
+
+
+namespace LoggerUtils{
+
+  // LogRecord
+  inline const std::string& LogRecord::getRenderedStr(bool enableColors_) const {
+    bool isColored{enableColors_ and enableColors};
+    std::string& outStr = (isColored ? _coloredStr_ : _plainStr_);
+    bool& isRendered = (isColored ? _isColoredStrRendered_ : _isPlainStrRendered_);
+    if( isRendered ) return outStr;
+
+    outStr.clear();
+    this->render(outStr, isColored, PayloadSanitizing::NONE);
+    isRendered = true;
+    return outStr;
+  }
+  inline const std::string& LogRecord::getRenderedStr(bool enableColors_, PayloadSanitizing sanitizing_, std::string& buffer_) const {
+    if( sanitizing_ == PayloadSanitizing::NONE or this->isPayloadSafe() ) return this->getRenderedStr(enableColors_);
+    buffer_.clear();
+    this->render(buffer_, enableColors_ and enableColors, sanitizing_);
+    return buffer_;
+  }
+  inline const std::string& LogRecord::getPayload(PayloadSanitizing sanitizing_, std::string& buffer_) const {
+    if( sanitizing_ == PayloadSanitizing::NONE or this->isPayloadSafe() ) return payload;
+    buffer_.clear();
+    appendSanitized(buffer_, payload.data(), payload.size(), sanitizing_);
+    return buffer_;
+  }
+  inline bool LogRecord::isPayloadSafe() const {
+    if( not _isPayloadChecked_ ){
+      _isPayloadSafe_ = isSafeStr(payload);
+      _isPayloadChecked_ = true;
+    }
+    return _isPayloadSafe_;
+  }
+  inline size_t LogRecord::getRenderedSize(bool enableColors_) const {
+    bool isColored{enableColors_ and enableColors};
+    size_t out = (isColored ? coloredPrefix.size() : plainPrefix.size()) + payload.size() + ( terminator != '\0' ? 1 : 0 );
+    if( isColored and payloadColor != nullptr and not payload.empty() ){ out += std::strlen(payloadColor) + std::strlen(LOGGER_STR_COLOR_RESET); }
+    return out;
+  }
+  inline void LogRecord::render(std::string& out_, bool isColored_, PayloadSanitizing sanitizing_) const {
+    out_ += (isColored_ ? coloredPrefix : plainPrefix);
+    bool isPayloadColored{isColored_ and payloadColor != nullptr and not payload.empty()};
+    if( isPayloadColored ) out_ += payloadColor;
+    appendSanitized(out_, payload.data(), payload.size(), sanitizing_);
+    if( isPayloadColored ) out_ += LOGGER_STR_COLOR_RESET;
+    if( terminator != '\0' ) out_ += terminator;
+  }
+  inline void LogRecord::clear(){
+    // capacities are kept: no allocation in steady state
+    terminator = '\0';
+    isLineStart = false;
+    payloadColor = nullptr;
+    coloredPrefix.clear();
+    plainPrefix.clear();
+    payload.clear();
+    _isColoredStrRendered_ = false;
+    _isPlainStrRendered_ = false;
+    _isPayloadChecked_ = false;
+  }
+
+  // LogSink
+  inline void LogSink::renderBlock(const std::vector<LogRecord>& recordList_, std::string& out_){
+    size_t size{0};
+    for( auto& record : recordList_ ){ size += this->getRenderedStr(record).size(); }
+    out_.reserve(out_.size() + size);
+    for( auto& record : recordList_ ){ out_ += this->getRenderedStr(record); }
+  }
+
+  // OStreamSink
+  inline void OStreamSink::write(const LogRecord& record_){
+    const std::string& str = this->getRenderedStr(record_);
+    _stream_->write(str.data(), static_cast<std::streamsize>(str.size()));
+  }
+  inline void OStreamSink::writeBlock(const std::vector<LogRecord>& recordList_){
+    std::string blockStr;
+    this->renderBlock(recordList_, blockStr);
+    _stream_->write(blockStr.data(), static_cast<std::streamsize>(blockStr.size()));
+  }
+  inline void OStreamSink::writeTerminalCommand(const std::string& command_){
+    if( not _enableColors_ ) return;
+    _stream_->write(command_.data(), static_cast<std::streamsize>(command_.size()));
+  }
+
+  // FileSink
+  inline void FileSink::write(const LogRecord& record_){
+    if( not _fileStream_.is_open() ) return;
+    const std::string& str = this->getRenderedStr(record_);
+    _fileStream_.write(str.data(), static_cast<std::streamsize>(str.size()));
+  }
+  inline void FileSink::writeBlock(const std::vector<LogRecord>& recordList_){
+    if( not _fileStream_.is_open() ) return;
+    std::string blockStr;
+    this->renderBlock(recordList_, blockStr);
+    _fileStream_.write(blockStr.data(), static_cast<std::streamsize>(blockStr.size()));
+  }
+
+  // CompressedFileSink
+  inline CompressedFileSink::CompressedFileSink(const std::string& filePath_, StreamCodec codec_, size_t blockSize_) :
+      _filePath_(filePath_), _blockSize_(std::max(blockSize_, size_t(4096))) {
+    if( not _compressor_.begin(codec_) ) return;
+    _fileStream_.open(_filePath_, std::ios::binary | std::ios::trunc);
+    if( not _fileStream_.is_open() ) return;
+    _currentBlock_.reserve(_blockSize_);
+    _compressionThread_ = std::thread([this]{ this->compressionLoop(); });
+  }
+  inline CompressedFileSink::~CompressedFileSink(){
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      _isStopping_ = true;
+    }
+    _wakeUpCondition_.notify_one();
+    if( _compressionThread_.joinable() ) _compressionThread_.join(); // the pending blocks and the trailer are written first
+  }
+  inline void CompressedFileSink::write(const LogRecord& record_){
+    if( not _fileStream_.is_open() ) return;
+    const std::string& str = this->getRenderedStr(record_);
+    bool isWakeUpNeeded{false};
+    {
+      std::unique_lock<std::mutex> lock(_mutex_);
+      if( _currentBlock_.empty() ) _currentBlockStartNs_ = getMonotonicTimeNs();
+      _currentBlock_ += str;
+      if( _currentBlock_.size() < _blockSize_ ) return;
+
+      // the output can't drop lines: past a few blocks, wait for the compression
+      if( _pendingBlockList_.size() >= maxPendingBlocks ){
+        StatsTimeScope queueWait{StatsTime::QUEUE_WAIT};
+        _drainedCondition_.wait(lock, [this]{ return _pendingBlockList_.size() < maxPendingBlocks; });
+      }
+      isWakeUpNeeded = _pendingBlockList_.empty();
+      _pendingBlockList_.emplace_back();
+      _pendingBlockList_.back().swap(_currentBlock_);
+      if( not _freeBlockList_.empty() ){
+        _currentBlock_.swap(_freeBlockList_.back());
+        _freeBlockList_.pop_back();
+      }
+      else{ _currentBlock_.reserve(_blockSize_); }
+    }
+    if( isWakeUpNeeded ) _wakeUpCondition_.notify_one();
+  }
+  inline void CompressedFileSink::sync(){
+    if( not _compressionThread_.joinable() ) return;
+    std::unique_lock<std::mutex> lock(_mutex_);
+    _isSyncRequested_ = true; // the partial block is compressed right away
+    _wakeUpCondition_.notify_one();
+    _drainedCondition_.wait(lock, [this]{ return not _isSyncRequested_; });
+  }
+  inline void CompressedFileSink::compressionLoop(){
+    std::vector<std::string> blockList;
+    std::string compressedBuffer;
+    auto flushPeriodNs = static_cast<uint64_t>(1E9 * LOGGER_OUTFILE_COMPRESSION_FLUSH_PERIOD);
+
+    std::unique_lock<std::mutex> lock(_mutex_);
+    while( true ){
+      // sleeps until the partial block is due
+      uint64_t nowNs = getMonotonicTimeNs();
+      uint64_t timeoutNs = flushPeriodNs;
+      if( not _currentBlock_.empty() ){ timeoutNs = ( _currentBlockStartNs_ + flushPeriodNs > nowNs ? _currentBlockStartNs_ + flushPeriodNs - nowNs : 0 ); }
+      _wakeUpCondition_.wait_for(lock, std::chrono::nanoseconds(timeoutNs), [this]{ return _isStopping_ or _isSyncRequested_ or not _pendingBlockList_.empty(); });
+      bool isStopping = _isStopping_;
+      bool isSyncRequested = _isSyncRequested_;
+
+      // flush point for the partial block: a quiet program still gets its lines on disk
+      if( not _currentBlock_.empty()
+          and (isStopping or isSyncRequested or getMonotonicTimeNs() - _currentBlockStartNs_ >= flushPeriodNs) ){
+        _pendingBlockList_.emplace_back();
+        _pendingBlockList_.back().swap(_currentBlock_);
+      }
+      blockList.swap(_pendingBlockList_);
+      lock.unlock();
+      _drainedCondition_.notify_all(); // room for the logging threads
+
+      for( auto& block : blockList ){
+        compressedBuffer.clear();
+        _compressor_.compressBlock(block.data(), block.size(), compressedBuffer);
+        _fileStream_.write(compressedBuffer.data(), static_cast<std::streamsize>(compressedBuffer.size()));
+        block.clear();
+      }
+      if( isStopping ){
+        compressedBuffer.clear();
+        _compressor_.finish(compressedBuffer);
+        _fileStream_.write(compressedBuffer.data(), static_cast<std::streamsize>(compressedBuffer.size()));
+      }
+      if( not blockList.empty() or isStopping ) _fileStream_.flush();
+
+      lock.lock();
+      for( auto& block : blockList ){
+        if( _freeBlockList_.size() < maxPendingBlocks ){ _freeBlockList_.emplace_back(); _freeBlockList_.back().swap(block); }
+      }
+      blockList.clear();
+      if( isSyncRequested and _pendingBlockList_.empty() ){
+        _isSyncRequested_ = false;
+        _drainedCondition_.notify_all();
+      }
+      if( isStopping ) break;
+    }
+    _fileStream_.close();
+  }
+
+  // BinaryFileSink
+  inline BinaryFileSink::BinaryFileSink(const std::string& filePath_){
+    if( not _writer_.open(filePath_) ) return;
+    _flushThread_ = std::thread([this]{ this->flushLoop(); });
+  }
+  inline BinaryFileSink::~BinaryFileSink(){
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      _isStopping_ = true;
+    }
+    _stopCondition_.notify_one();
+    if( _flushThread_.joinable() ) _flushThread_.join();
+    _writer_.close();
+  }
+  inline void BinaryFileSink::flushLoop(){
+    // a quiet program still gets its lines on disk. The writer has its own lock.
+    auto flushPeriodNs = static_cast<uint64_t>(1E9 * LOGGER_BINARY_FLUSH_PERIOD);
+    std::unique_lock<std::mutex> lock(_mutex_);
+    while( not _stopCondition_.wait_for(lock, std::chrono::nanoseconds(flushPeriodNs / 2), [this]{ return _isStopping_; }) ){
+      _writer_.flushOlderThan(flushPeriodNs);
+    }
+  }
+  inline void BinaryFileSink::write(const LogRecord& record_){
+    if( _pendingRecord_.payload.empty() ){
+      // the record takes the context of the piece which started the line
+      _pendingRecord_.logLevel = record_.logLevel;
+      _pendingRecord_.fileName = record_.fileName;
+      _pendingRecord_.lineNumber = record_.lineNumber;
+      _pendingRecord_.threadId = record_.threadId;
+      _pendingRecord_.timestamp = record_.timestamp;
+    }
+    _pendingRecord_.payload += this->getPayload(record_);
+    if( record_.terminator == '\0' or _pendingRecord_.payload.empty() ) return;
+
+    _writer_.writeRecord(
+        _pendingRecord_.logLevel, _pendingRecord_.fileName, _pendingRecord_.lineNumber,
+        _pendingRecord_.threadId, _pendingRecord_.timestamp,
+        _pendingRecord_.payload.data(), _pendingRecord_.payload.size()
+    );
+    _pendingRecord_.clear();
+  }
+
+#if !defined(_WIN32)
+  // SyslogSink
+  inline SyslogSink::SyslogSink(const std::string& ident_, const std::string& socketPath_, int facility_) :
+      _ident_(ident_), _socketPath_(socketPath_), _facility_(facility_) {
+    if( _ident_.empty() ) _ident_ = getExecutableName();
+    _messageList_.resize(LOGGER_SYSLOG_BATCH_SIZE);
+    this->connectSocket();
+    _flushThread_ = std::thread([this]{ this->flushLoop(); });
+  }
+  inline SyslogSink::~SyslogSink(){
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      _isStopping_ = true;
+    }
+    _stopCondition_.notify_one();
+    if( _flushThread_.joinable() ) _flushThread_.join();
+    this->sendBatch();
+    if( _socket_ >= 0 ) ::close(_socket_);
+  }
+  inline void SyslogSink::flushLoop(){
+    // a quiet program still gets its lines to the daemon
+    auto flushPeriodNs = static_cast<uint64_t>(1E9 * LOGGER_SYSLOG_FLUSH_PERIOD);
+    std::unique_lock<std::mutex> lock(_mutex_);
+    while( not _stopCondition_.wait_for(lock, std::chrono::nanoseconds(flushPeriodNs / 2), [this]{ return _isStopping_; }) ){
+      if( _nbMessages_ != 0 and getMonotonicTimeNs() - _batchStartNs_ >= flushPeriodNs ) this->sendBatch();
+    }
+  }
+  inline void SyslogSink::write(const LogRecord& record_){
+    if( _pendingRecord_.payload.empty() ){
+      _pendingRecord_.logLevel = record_.logLevel;
+      _pendingRecord_.timestamp = record_.timestamp;
+    }
+    _pendingRecord_.payload += this->getPayload(record_);
+    if( record_.terminator == '\0' ) return;
+    if( _pendingRecord_.payload.empty() ){ _pendingRecord_.clear(); return; }
+
+    // RFC 3164 as sent by syslog(3): "<PRI>Mmm dd hh:mm:ss ident[pid]: message"
+    char header[64];
+    time_t seconds = static_cast<time_t>(_pendingRecord_.timestamp / 1000000000ULL);
+    struct tm localTime{};
+    localtime_r(&seconds, &localTime);
+    int headerSize = std::snprintf(header, sizeof(header), "<%d>", _facility_ | getSyslogPriority(_pendingRecord_.logLevel));
+    headerSize += int(std::strftime(header + headerSize, sizeof(header) - size_t(headerSize), "%b %e %H:%M:%S ", &localTime));
+
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( _nbMessages_ == 0 ) _batchStartNs_ = getMonotonicTimeNs();
+    std::string& message = _messageList_[_nbMessages_++];
+    message.assign(header, size_t(headerSize));
+    message += _ident_;
+    message += '[';
+    message += std::to_string(::getpid());
+    message += "]: ";
+    message += _pendingRecord_.payload;
+    if( message.size() > LOGGER_SYSLOG_MAX_MESSAGE_SIZE ) message.resize(LOGGER_SYSLOG_MAX_MESSAGE_SIZE);
+    _pendingRecord_.clear();
+
+    if( _nbMessages_ == _messageList_.size() ) this->sendBatch();
+  }
+  inline void SyslogSink::sync(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    this->sendBatch();
+  }
+  inline int SyslogSink::getSyslogPriority(int logLevel_){
+    // levels: FATAL=0, ERROR=1, ALERT=2, WARNING=3, INFO=4, DEBUG=5, TRACE=6
+    // LOG_ALERT (1) is more urgent than LOG_CRIT for syslog: the logger's ALERT is rather a LOG_WARNING
+    static const int priorityList[] = { 2 /* LOG_CRIT */, 3 /* LOG_ERR */, 4 /* LOG_WARNING */, 4 /* LOG_WARNING */, 6 /* LOG_INFO */, 7 /* LOG_DEBUG */, 7 /* LOG_DEBUG */ };
+    if( logLevel_ < 0 ) return priorityList[0];
+    if( logLevel_ > 6 ) return priorityList[6];
+    return priorityList[logLevel_];
+  }
+  inline bool SyslogSink::connectSocket(){
+    if( _socket_ >= 0 ){ ::close(_socket_); _socket_ = -1; }
+    struct sockaddr_un address{};
+    if( _socketPath_.size() >= sizeof(address.sun_path) ) return false;
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, _socketPath_.c_str(), _socketPath_.size() + 1);
+
+    _socket_ = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    if( _socket_ < 0 ) return false;
+    ::fcntl(_socket_, F_SETFD, FD_CLOEXEC);
+    if( ::connect(_socket_, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0 ){
+      ::close(_socket_);
+      _socket_ = -1;
+      return false;
+    }
+    return true;
+  }
+  inline void SyslogSink::sendBatch(){
+    if( _nbMessages_ == 0 ) return;
+    size_t nbMessages = _nbMessages_;
+    _nbMessages_ = 0;
+
+    // the daemon might have been restarted: one reconnection attempt
+    for( int iAttempt = 0 ; iAttempt < 2 ; iAttempt++ ){
+      if( _socket_ < 0 and not this->connectSocket() ) return;
+
+      size_t iFirst{0};
+#if defined(__linux__)
+      struct iovec iovList[LOGGER_SYSLOG_BATCH_SIZE];
+      struct mmsghdr headerList[LOGGER_SYSLOG_BATCH_SIZE];
+      std::memset(headerList, 0, sizeof(headerList));
+      for( size_t iMsg = 0 ; iMsg < nbMessages ; iMsg++ ){
+        iovList[iMsg].iov_base = const_cast<char*>(_messageList_[iMsg].data());
+        iovList[iMsg].iov_len = _messageList_[iMsg].size();
+        headerList[iMsg].msg_hdr.msg_iov = &iovList[iMsg];
+        headerList[iMsg].msg_hdr.msg_iovlen = 1;
+      }
+      while( iFirst < nbMessages ){
+        int nbSent = ::sendmmsg(_socket_, headerList + iFirst, static_cast<unsigned int>(nbMessages - iFirst), 0);
+        if( nbSent < 0 ){
+          if( errno == EINTR ) continue;
+          break;
+        }
+        iFirst += size_t(nbSent);
+      }
+#else
+      while( iFirst < nbMessages ){
+        if( ::send(_socket_, _messageList_[iFirst].data(), _messageList_[iFirst].size(), 0) < 0 ){
+          if( errno == EINTR ) continue;
+          break;
+        }
+        iFirst++;
+      }
+#endif
+      if( iFirst == nbMessages ) return;
+
+      // keep the remaining ones for the retry
+      if( errno != ECONNREFUSED and errno != ENOTCONN and errno != ENOENT ) return; // dropped
+      for( size_t iMsg = iFirst ; iMsg < nbMessages ; iMsg++ ){ _messageList_[iMsg - iFirst].swap(_messageList_[iMsg]); }
+      nbMessages -= iFirst;
+      ::close(_socket_);
+      _socket_ = -1;
+    }
+  }
+
+  // SharedRingSink
+  inline void SharedRingSink::write(const LogRecord& record_){
+    if( _pendingRecord_.payload.empty() ){
+      _pendingRecord_.logLevel = record_.logLevel;
+      _pendingRecord_.timestamp = record_.timestamp;
+    }
+    _pendingRecord_.payload += this->getRenderedStr(record_); // prefix included: the consumer writes the lines as is
+    if( record_.terminator == '\0' ) return;
+
+    _writer_.write(_pendingRecord_.logLevel, _pendingRecord_.timestamp, _pendingRecord_.payload.data(), _pendingRecord_.payload.size());
+    _pendingRecord_.clear();
+  }
+#endif
+
+  // AsyncSink
+  inline AsyncSink::AsyncSink(std::shared_ptr<LogSink> sink_, size_t maxBacklogSize_) : _sink_(std::move(sink_)), _maxBacklogSize_(maxBacklogSize_) {
+    if( _sink_ != nullptr ){
+      _maxLogLevel_ = _sink_->getMaxLogLevel();
+      _enableColors_ = _sink_->isEnableColors();
+    }
+    _nextReportNs_ = getMonotonicTimeNs() + static_cast<uint64_t>(1E9 * LOGGER_ASYNC_DROP_REPORT_PERIOD);
+    _writerThread_ = std::thread([this]{ this->writerLoop(); });
+  }
+  inline AsyncSink::~AsyncSink(){
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      _isStopping_ = true;
+    }
+    _wakeUpCondition_.notify_one();
+    if( _writerThread_.joinable() ) _writerThread_.join(); // the backlog is written first
+  }
+  inline void AsyncSink::write(const LogRecord& record_){
+    if( _sink_ == nullptr or not _sink_->isAccepting(record_) ) return;
+    bool isWakeUpNeeded;
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      if( record_.threadSlot >= _droppingLineList_.size() ) _droppingLineList_.resize(record_.threadSlot + 1, 0);
+      uint32_t& droppingLine = _droppingLineList_[record_.threadSlot];
+      bool isDroppingLine{droppingLine == record_.threadId + 1}; // not set by a previous owner of the slot
+      if( isDroppingLine or this->isDropping(record_) ){
+        if( not isDroppingLine ){ _nbDroppedList_[std::min(std::max(record_.logLevel, 0), nLogLevels - 1)].fetch_add(1, std::memory_order_relaxed); }
+        droppingLine = ( record_.terminator == '\0' ? record_.threadId + 1 : 0 );
+        return;
+      }
+      isWakeUpNeeded = _pendingList_.empty(); // otherwise the writer is already busy
+      _pendingList_.emplace_back();
+      _pendingList_.back().record = record_;
+      _backlogSize_ += record_.coloredPrefix.size() + record_.payload.size() + 1;
+    }
+    if( isWakeUpNeeded ) _wakeUpCondition_.notify_one();
+  }
+  inline void AsyncSink::writeTerminalCommand(const std::string& command_){
+    if( _sink_ == nullptr ) return;
+    bool isWakeUpNeeded;
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      if( _backlogSize_ >= _maxBacklogSize_ ) return; // cursor moves are meaningless if lines are dropped
+      isWakeUpNeeded = _pendingList_.empty();
+      _pendingList_.emplace_back();
+      _pendingList_.back().isTerminalCommand = true;
+      _pendingList_.back().terminalCommand = command_;
+      _backlogSize_ += command_.size();
+    }
+    if( isWakeUpNeeded ) _wakeUpCondition_.notify_one();
+  }
+  inline void AsyncSink::flush(){
+    // the writer flushes the wrapped sink after each batch
+    _wakeUpCondition_.notify_one();
+  }
+  inline void AsyncSink::sync(){
+    {
+      std::unique_lock<std::mutex> lock(_mutex_);
+      _wakeUpCondition_.notify_one();
+      _drainedCondition_.wait(lock, [this]{ return _pendingList_.empty() and not _isWriting_; });
+    }
+    if( _sink_ != nullptr ) _sink_->sync();
+  }
+  inline uint64_t AsyncSink::getNbDroppedLines() const {
+    uint64_t out{0};
+    for( auto& nbDropped : _nbDroppedList_ ){ out += nbDropped.load(std::memory_order_relaxed); }
+    return out;
+  }
+  inline uint64_t AsyncSink::getNbDroppedLines(int logLevel_) const {
+    if( logLevel_ < 0 or logLevel_ >= nLogLevels ) return 0;
+    return _nbDroppedList_[logLevel_].load(std::memory_order_relaxed);
+  }
+  inline bool AsyncSink::isDropping(const LogRecord& record_) const {
+    // levels: FATAL=0, ERROR=1, ALERT=2, WARNING=3, INFO=4, DEBUG=5, TRACE=6
+    if( record_.logLevel <= 1 ) return false;
+    if( record_.logLevel <= 3 ) return _backlogSize_ >= 2 * _maxBacklogSize_;
+    return _backlogSize_ >= _maxBacklogSize_;
+  }
+  inline void AsyncSink::writerLoop(){
+    std::vector<Entry> writingList;
+    auto reportPeriod = std::chrono::milliseconds(static_cast<long long>(1E3 * LOGGER_ASYNC_DROP_REPORT_PERIOD));
+    std::unique_lock<std::mutex> lock(_mutex_);
+    while( true ){
+      _wakeUpCondition_.wait_for(lock, reportPeriod, [this]{ return _isStopping_ or not _pendingList_.empty(); });
+      bool isStopping = _isStopping_;
+      writingList.swap(_pendingList_);
+      _backlogSize_ = 0;
+      _isWriting_ = true;
+      lock.unlock();
+
+      // the output can stall here without blocking the logging threads
+      for( auto& entry : writingList ){
+        if( entry.isTerminalCommand ){ _sink_->writeTerminalCommand(entry.terminalCommand); }
+        else{ _sink_->write(entry.record); }
+      }
+      if( not writingList.empty() ) _sink_->flush();
+      writingList.clear();
+      this->reportDroppedLines();
+
+      lock.lock();
+      _isWriting_ = false;
+      if( _pendingList_.empty() ){
+        _drainedCondition_.notify_all();
+        if( isStopping ) break;
+      }
+    }
+  }
+  inline void AsyncSink::reportDroppedLines(){
+    bool isStopping;
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      isStopping = _isStopping_;
+    }
+    uint64_t nowNs = getMonotonicTimeNs();
+    if( not isStopping and nowNs < _nextReportNs_ ) return;
+    _nextReportNs_ = nowNs + static_cast<uint64_t>(1E9 * LOGGER_ASYNC_DROP_REPORT_PERIOD);
+
+    static const char* levelNameList[nLogLevels] = {"FATAL", "ERROR", "ALERT", "WARNING", "INFO", "DEBUG", "TRACE", "INVALID"};
+    uint64_t nbDroppedTotal{0};
+    std::string detailsStr;
+    for( int iLevel = 0 ; iLevel < nLogLevels ; iLevel++ ){
+      uint64_t nbDropped = _nbDroppedList_[iLevel].load(std::memory_order_relaxed);
+      uint64_t nbNewlyDropped = nbDropped - _nbReportedList_[iLevel];
+      _nbReportedList_[iLevel] = nbDropped;
+      if( nbNewlyDropped == 0 ) continue;
+      nbDroppedTotal += nbNewlyDropped;
+      if( not detailsStr.empty() ) detailsStr += ", ";
+      detailsStr += std::to_string(nbNewlyDropped) + " " + levelNameList[iLevel];
+    }
+    if( nbDroppedTotal == 0 ) return;
+
+    LogRecord summary;
+    summary.logLevel = 3; // WARNING
+    summary.timestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count()
+    );
+    summary.payload = "[Logger] " + std::to_string(nbDroppedTotal) + " line(s) dropped while the output was blocked (" + detailsStr + ")";
+    summary.terminator = '\n';
+    _sink_->write(summary);
+    _sink_->flush();
+  }
+
+  // RepeatedLineFilter
+  template<typename WriteFunc> inline bool RepeatedLineFilter::process(const LogRecord& record_, WriteFunc write_){
+    if( record_.threadSlot >= _stateList_.size() ) _stateList_.resize(record_.threadSlot + 1);
+    auto& state = _stateList_[record_.threadSlot];
+    if( state.isValid and state.lastRecord.threadId != record_.threadId ){
+      // slot of an exited thread: its pending repetitions are reported
+      this->releaseState(state, write_);
+      state.isValid = false;
+    }
+
+    if( record_.terminator != '\n' or not record_.isLineStart ){
+      // piece of line: not handled, but it ends the repetition
+      this->releaseState(state, write_);
+      state.isValid = false;
+      return true;
+    }
+
+    size_t hash = getHash(record_);
+    if( state.isValid and hash == state.hash and record_.timestamp < state.windowEnd and isSameLine(record_, state.lastRecord) ){
+      if( state.nRepeats++ == 0 ){ _nextExpiry_ = std::min(_nextExpiry_, state.windowEnd); }
+      state.lastRecord.timestamp = record_.timestamp;
+      state.lastRecord.coloredPrefix = record_.coloredPrefix;
+      state.lastRecord.plainPrefix = record_.plainPrefix;
+      return false;
+    }
+
+    // new reference line
+    this->releaseState(state, write_);
+    state.isValid = true;
+    state.hash = hash;
+    state.windowEnd = record_.timestamp + _windowNs_;
+    auto& last = state.lastRecord;
+    last.logLevel = record_.logLevel;
+    last.lineNumber = record_.lineNumber;
+    last.threadId = record_.threadId;
+    last.threadSlot = record_.threadSlot;
+    last.timestamp = record_.timestamp;
+    last.enableColors = record_.enableColors;
+    last.isLineStart = true;
+    last.fileName = record_.fileName;
+    last.coloredPrefix = record_.coloredPrefix;
+    last.plainPrefix = record_.plainPrefix;
+    last.payload = record_.payload;
+    return true;
+  }
+  template<typename WriteFunc> inline void RepeatedLineFilter::releaseExpired(uint64_t timestamp_, WriteFunc write_){
+    if( timestamp_ < _nextExpiry_ ) return; // single comparison in the usual case
+    _nextExpiry_ = std::numeric_limits<uint64_t>::max();
+    for( auto& state : _stateList_ ){
+      if( state.nRepeats == 0 ) continue;
+      if( state.windowEnd <= timestamp_ ){ this->releaseState(state, write_); state.isValid = false; }
+      else{ _nextExpiry_ = std::min(_nextExpiry_, state.windowEnd); }
+    }
+  }
+  template<typename WriteFunc> inline void RepeatedLineFilter::releaseAll(WriteFunc write_){
+    for( auto& state : _stateList_ ){ this->releaseState(state, write_); state.isValid = false; }
+    _nextExpiry_ = std::numeric_limits<uint64_t>::max();
+  }
+  inline size_t RepeatedLineFilter::getHash(const LogRecord& record_){
+    size_t out = std::hash<std::string>()(record_.payload);
+    hashCombine(out, record_.lineNumber);
+    hashCombine(out, record_.logLevel);
+    hashCombine(out, record_.fileName);
+    return out;
+  }
+  inline bool RepeatedLineFilter::isSameLine(const LogRecord& a_, const LogRecord& b_){
+    // guards against hash collisions
+    return a_.lineNumber == b_.lineNumber and a_.logLevel == b_.logLevel
+           and a_.payload == b_.payload and a_.fileName == b_.fileName;
+  }
+  template<typename WriteFunc> inline void RepeatedLineFilter::releaseState(ThreadState& state_, WriteFunc write_){
+    if( state_.nRepeats == 0 ) return;
+    auto& last = state_.lastRecord;
+    _summaryRecord_.clear();
+    _summaryRecord_.logLevel = last.logLevel;
+    _summaryRecord_.lineNumber = last.lineNumber;
+    _summaryRecord_.threadId = last.threadId;
+    _summaryRecord_.threadSlot = last.threadSlot;
+    _summaryRecord_.timestamp = last.timestamp;
+    _summaryRecord_.enableColors = last.enableColors;
+    _summaryRecord_.isLineStart = true;
+    _summaryRecord_.fileName = last.fileName;
+    _summaryRecord_.coloredPrefix = last.coloredPrefix;
+    _summaryRecord_.plainPrefix = last.plainPrefix;
+    _summaryRecord_.payload = "previous message repeated " + std::to_string(state_.nRepeats) + ( state_.nRepeats == 1 ? " time" : " times" );
+    _summaryRecord_.terminator = '\n';
+    state_.nRepeats = 0;
+    write_(_summaryRecord_);
+  }
+
+  // LogSinkDispatcher
+  inline LogSinkDispatcher::LogSinkDispatcher(){
+    getStatsRegistry(); // constructed first, so destroyed after the dispatcher
+    // std::cout is hooked by the StreamBufferSupervisor which keeps track of the last printed char
+    _sinkEntryList_.push_back({"console", std::make_shared<OStreamSink>(std::cout), 0, 0});
+    _repeatedLineFilter_.setWindow(static_cast<uint64_t>(1E9 * LOGGER_COLLAPSE_REPEATED_WINDOW));
+  }
+  inline LogSinkDispatcher::~LogSinkDispatcher(){
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      _isStopping_ = true;
+    }
+    _expiryCondition_.notify_one();
+    if( _expiryThread_.joinable() ) _expiryThread_.join();
+
+    // pending "repeated" lines
+    this->setCollapseRepeatedLines(false);
+    this->sync();
+#if LOGGER_ENABLE_STATS
+    // final state of the counters
+    std::string statsFilePath{getStatsRegistry().getStatsFilePath()};
+    if( not statsFilePath.empty() ){ StatsRegistry::writeStatsFile(statsFilePath, this->getStats()); }
+#endif
+  }
+  inline void LogSinkDispatcher::addSink(const std::shared_ptr<LogSink>& sink_, const std::string& name_){
+    if( sink_ == nullptr ) return;
+    std::lock_guard<std::mutex> lock(_mutex_);
+    _sinkEntryList_.push_back({name_, sink_, 0, 0});
+  }
+  inline void LogSinkDispatcher::removeSink(const std::string& name_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    _sinkEntryList_.erase(
+        std::remove_if(_sinkEntryList_.begin(), _sinkEntryList_.end(), [&](const SinkEntry& entry_){ return entry_.name == name_; }),
+        _sinkEntryList_.end()
+    );
+  }
+  inline void LogSinkDispatcher::removeSink(const std::shared_ptr<LogSink>& sink_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    _sinkEntryList_.erase(
+        std::remove_if(_sinkEntryList_.begin(), _sinkEntryList_.end(), [&](const SinkEntry& entry_){ return entry_.sink == sink_; }),
+        _sinkEntryList_.end()
+    );
+  }
+  inline void LogSinkDispatcher::clearSinks(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    for( auto& entry : _sinkEntryList_ ){ entry.sink->flush(); }
+    _sinkEntryList_.clear();
+  }
+  inline std::shared_ptr<LogSink> LogSinkDispatcher::getSink(const std::string& name_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    for( auto& entry : _sinkEntryList_ ){
+      if( entry.name == name_ ) return entry.sink;
+    }
+    return nullptr;
+  }
+  template<typename SinkFactory> inline std::shared_ptr<LogSink> LogSinkDispatcher::getOrAddSink(const std::string& name_, SinkFactory factory_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    for( auto& entry : _sinkEntryList_ ){
+      if( entry.name == name_ ) return entry.sink;
+    }
+    std::shared_ptr<LogSink> sink = factory_();
+    if( sink != nullptr ) _sinkEntryList_.push_back({name_, sink, 0, 0});
+    return sink;
+  }
+  inline std::shared_ptr<LogSink> LogSinkDispatcher::replaceSink(const std::string& name_, const std::shared_ptr<LogSink>& sink_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    for( auto& entry : _sinkEntryList_ ){
+      if( entry.name != name_ ) continue;
+      std::shared_ptr<LogSink> previousSink = entry.sink;
+      entry.sink = sink_;
+      return previousSink;
+    }
+    _sinkEntryList_.push_back({name_, sink_, 0, 0});
+    return nullptr;
+  }
+  inline void LogSinkDispatcher::dispatch(const LogRecord& record_){
+    if( LOGGER_ENABLE_STATS ){ getThreadStats().addRecord(record_.logLevel, record_.payload.size()); }
+    {
+      StatsLockGuard lock(_mutex_, StatsTime::SINK_LOCK_WAIT, StatsTime::SINK_LOCK_HELD);
+      bool isCollapsed{false};
+      if( _collapseRepeatedLines_ ){
+        auto writeFct = [this](const LogRecord& summary_){ this->writeToSinks(summary_); };
+        uint64_t nextExpiry = _repeatedLineFilter_.getNextExpiry();
+        _repeatedLineFilter_.releaseExpired(record_.timestamp, writeFct);
+        isCollapsed = not _repeatedLineFilter_.process(record_, writeFct);
+        if( _repeatedLineFilter_.getNextExpiry() < nextExpiry ){ _expiryCondition_.notify_one(); } // sooner than expected by the thread
+      }
+      if( isCollapsed ){ _nbCollapsedLines_++; }
+      else{ this->writeToSinks(record_); }
+    }
+    if( LOGGER_ENABLE_STATS ){ this->writeStatsOutputs(); }
+  }
+  inline void LogSinkDispatcher::dispatchBlock(const std::vector<LogRecord>& recordList_){
+    if( recordList_.empty() ) return;
+    if( LOGGER_ENABLE_STATS ){
+      auto& threadStats = getThreadStats();
+      for( auto& record : recordList_ ){ threadStats.addRecord(record.logLevel, record.payload.size()); }
+    }
+    {
+      StatsLockGuard lock(_mutex_, StatsTime::SINK_LOCK_WAIT, StatsTime::SINK_LOCK_HELD);
+      if( _collapseRepeatedLines_ ){
+        // the lines of a block are never collapsed (table separators...): the pending repetitions are reported before
+        _repeatedLineFilter_.releaseAll([this](const LogRecord& summary_){ this->writeToSinks(summary_); });
+      }
+      // all the lines have the same level
+      for( auto& entry : _sinkEntryList_ ){
+        if( not entry.sink->isAccepting(recordList_.front()) ) continue;
+        entry.sink->writeBlock(recordList_);
+        entry.nbRecords += recordList_.size();
+        for( auto& record : recordList_ ){ entry.nbBytes += record.getRenderedSize(entry.sink->isEnableColors()); }
+      }
+    }
+    if( LOGGER_ENABLE_STATS ){ this->writeStatsOutputs(); }
+  }
+  inline void LogSinkDispatcher::dispatchTerminalCommand(const std::string& command_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    for( auto& entry : _sinkEntryList_ ){ entry.sink->writeTerminalCommand(command_); }
+  }
+  inline void LogSinkDispatcher::flush(){
+    if( LOGGER_ENABLE_STATS ){ getThreadStats().addFlush(); }
+    StatsLockGuard lock(_mutex_, StatsTime::SINK_LOCK_WAIT, StatsTime::SINK_LOCK_HELD);
+    for( auto& entry : _sinkEntryList_ ){ entry.sink->flush(); }
+  }
+  inline void LogSinkDispatcher::sync(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    for( auto& entry : _sinkEntryList_ ){ entry.sink->sync(); }
+  }
+  inline void LogSinkDispatcher::setCollapseRepeatedLines(bool collapseRepeatedLines_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( _collapseRepeatedLines_ and not collapseRepeatedLines_ ){
+      _repeatedLineFilter_.releaseAll([this](const LogRecord& summary_){ this->writeToSinks(summary_); });
+    }
+    _collapseRepeatedLines_ = collapseRepeatedLines_;
+    if( _collapseRepeatedLines_ and not _isStopping_ and not _expiryThread_.joinable() ){
+      _expiryThread_ = std::thread([this]{ this->expiryLoop(); });
+    }
+  }
+  inline LoggerStats LogSinkDispatcher::getStats(){
+    LoggerStats out;
+    getStatsRegistry().mergeInto(out);
+    std::lock_guard<std::mutex> lock(_mutex_);
+    out.nbCollapsedLines = _nbCollapsedLines_;
+    for( auto& entry : _sinkEntryList_ ){
+      out.sinkList.emplace_back();
+      out.sinkList.back().name = entry.name;
+      out.sinkList.back().nbRecords = entry.nbRecords;
+      out.sinkList.back().nbBytes = entry.nbBytes;
+      out.sinkList.back().nbDropped = entry.sink->getNbDroppedLines();
+      out.nbDroppedLines += out.sinkList.back().nbDropped;
+    }
+    return out;
+  }
+  inline void LogSinkDispatcher::writeToSinks(const LogRecord& record_){
+    for( auto& entry : _sinkEntryList_ ){
+      if( not entry.sink->isAccepting(record_) ) continue;
+      entry.sink->write(record_);
+      entry.nbRecords++;
+      entry.nbBytes += record_.getRenderedSize(entry.sink->isEnableColors());
+    }
+  }
+  inline void LogSinkDispatcher::expiryLoop(){
+    // a quiet thread still gets its summary once the window is over, not with its next line
+    std::unique_lock<std::mutex> lock(_mutex_);
+    while( not _isStopping_ ){
+      uint64_t nextExpiry = _repeatedLineFilter_.getNextExpiry();
+      if( nextExpiry == std::numeric_limits<uint64_t>::max() ){ _expiryCondition_.wait(lock); continue; }
+      auto nowNs = static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count()
+      );
+      if( nowNs < nextExpiry ){ _expiryCondition_.wait_for(lock, std::chrono::nanoseconds(nextExpiry - nowNs)); continue; }
+
+      bool isReleased{false};
+      _repeatedLineFilter_.releaseExpired(nowNs, [&](const LogRecord& summary_){ this->writeToSinks(summary_); isReleased = true; });
+      if( isReleased ){
+        for( auto& entry : _sinkEntryList_ ){ entry.sink->flush(); }
+      }
+    }
+  }
+  inline void LogSinkDispatcher::writeStatsOutputs(){
+    // called without the lock, by the first thread dispatching a line once an interval elapsed
+    auto& registry = getStatsRegistry();
+    bool isReportDue = registry.claimReport();
+    bool isFileDue = registry.claimFileWrite();
+    if( not isReportDue and not isFileDue ) return;
+
+    LoggerStats stats = this->getStats();
+    if( isFileDue ){ StatsRegistry::writeStatsFile(registry.getStatsFilePath(), stats); }
+    if( isReportDue ){
+      LogRecord summary;
+      summary.logLevel = 4; // INFO
+      summary.threadId = getThreadIdentity().number;
+      summary.threadSlot = getThreadIdentity().slot;
+      summary.timestamp = static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count()
+      );
+      summary.payload = "[Logger] " + stats.getSummaryStr();
+      summary.terminator = '\n';
+      this->dispatch(summary);
+    }
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERSINKS_IMPL_H
@@ -0,0 +1,56 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+#include "LoggerMacros.h"
+
+#include <mutex>
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+
+
+// Call stacks of Logger::throwError() and LogFatal (see LOGGER_ENABLE_STACK_TRACE): only the return addresses are recorded,
+// they are turned into function names when the trace is printed, once per address
+namespace LoggerUtils{
+
+  struct StackTrace{
+    void* addressList[LOGGER_STACK_TRACE_MAX_DEPTH];
+    int depth{0}; // 0 if the capture is disabled or not supported
+
+    bool empty() const { return depth == 0; }
+    inline std::string toString() const; // one frame per line, innermost first
+  };
+  // no symbol lookup, no allocation. A template to stay out of line (LOGGER_COLD) without the "inline" keyword.
+  template<int = 0> LOGGER_COLD StackTrace captureStackTrace(int nSkippedFrames_ = 0);
+
+  class SymbolCache{
+    // Shared by all the source files
+  public:
+    inline std::string getSymbolStr(void* address_); // "function + 0x1c (module)", or "module + 0x1234" to feed addr2line
+
+  private:
+    std::mutex _mutex_{};
+    std::unordered_map<uintptr_t, std::string> _symbolMap_{};
+  };
+  inline SymbolCache& getSymbolCache(){ static SymbolCache cache; return cache; }
+
+  class TracedRuntimeError : public std::runtime_error{
+    // Thrown by Logger::throwError(): a std::runtime_error carrying the call stack of the throw
+  public:
+    TracedRuntimeError(const std::string& what_, const StackTrace& stackTrace_) : std::runtime_error(what_), _stackTrace_(stackTrace_) {}
+    const StackTrace& getStackTrace() const { return _stackTrace_; }
+
+  private:
+    StackTrace _stackTrace_;
+  };
+  inline std::string getStackTraceStr(const std::exception& exception_); // empty if the exception carries no trace
+
+}
+
+#include "LoggerStackTrace.impl.h"
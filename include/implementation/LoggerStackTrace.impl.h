@@ -0,0 +1,100 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERSTACKTRACE_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERSTACKTRACE_IMPL_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring> // strrchr
+
+#if LOGGER_ENABLE_STACK_TRACE
+#if defined(_WIN32)
+#include <windows.h>
+#define LOGGER_STACK_TRACE_WINDOWS
+#elif defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#include <dlfcn.h>
+#include <cxxabi.h>
+#define LOGGER_STACK_TRACE_EXECINFO
+#endif
+#endif // LOGGER_ENABLE_STACK_TRACE
+
+
+namespace LoggerUtils{
+
+  template<int> StackTrace captureStackTrace(int nSkippedFrames_){
+    StackTrace out;
+    nSkippedFrames_ += 1; // this function
+#if defined(LOGGER_STACK_TRACE_EXECINFO)
+    void* addressList[LOGGER_STACK_TRACE_MAX_DEPTH + 8];
+    int nFrames = backtrace(addressList, LOGGER_STACK_TRACE_MAX_DEPTH + 8);
+    for( int iFrame = nSkippedFrames_ ; iFrame < nFrames and out.depth < LOGGER_STACK_TRACE_MAX_DEPTH ; iFrame++ ){
+      out.addressList[out.depth++] = addressList[iFrame];
+    }
+#elif defined(LOGGER_STACK_TRACE_WINDOWS)
+    out.depth = int(CaptureStackBackTrace(DWORD(nSkippedFrames_), LOGGER_STACK_TRACE_MAX_DEPTH, out.addressList, nullptr));
+#else
+    (void) nSkippedFrames_;
+#endif
+    return out;
+  }
+
+  inline std::string StackTrace::toString() const {
+    std::string out;
+    char buffer[64];
+    for( int iFrame = 0 ; iFrame < depth ; iFrame++ ){
+      if( iFrame != 0 ) out += "\n";
+      std::snprintf(buffer, sizeof(buffer), "#%-2d %p in ", iFrame, addressList[iFrame]);
+      out += buffer;
+      out += getSymbolCache().getSymbolStr(addressList[iFrame]);
+    }
+    return out;
+  }
+
+  // SymbolCache
+  inline std::string SymbolCache::getSymbolStr(void* address_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    auto symbolIt = _symbolMap_.find(reinterpret_cast<uintptr_t>(address_));
+    if( symbolIt != _symbolMap_.end() ) return symbolIt->second;
+
+    std::string symbolStr{"??"};
+#if defined(LOGGER_STACK_TRACE_EXECINFO)
+    Dl_info info;
+    if( dladdr(address_, &info) != 0 and info.dli_fname != nullptr ){
+      const char* moduleName = std::strrchr(info.dli_fname, '/');
+      moduleName = ( moduleName != nullptr ? moduleName + 1 : info.dli_fname );
+
+      char buffer[32];
+      if( info.dli_sname != nullptr and info.dli_saddr != nullptr ){
+        int status{-1};
+        char* demangledName = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        symbolStr = ( status == 0 and demangledName != nullptr ? demangledName : info.dli_sname );
+        std::free(demangledName);
+        std::snprintf(buffer, sizeof(buffer), " + 0x%lx", static_cast<unsigned long>(static_cast<char*>(address_) - static_cast<char*>(info.dli_saddr)));
+        symbolStr += buffer;
+        symbolStr += " (" + std::string(moduleName) + ")";
+      }
+      else{
+        // not exported (static function, or executable linked without -rdynamic): the offset can be fed to addr2line
+        std::snprintf(buffer, sizeof(buffer), " + 0x%lx", static_cast<unsigned long>(static_cast<char*>(address_) - static_cast<char*>(info.dli_fbase)));
+        symbolStr = moduleName;
+        symbolStr += buffer;
+      }
+    }
+#endif
+
+    _symbolMap_.emplace(reinterpret_cast<uintptr_t>(address_), symbolStr);
+    return symbolStr;
+  }
+
+  inline std::string getStackTraceStr(const std::exception& exception_){
+    auto* tracedError = dynamic_cast<const TracedRuntimeError*>(&exception_);
+    if( tracedError == nullptr ) return {};
+    return tracedError->getStackTrace().toString();
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERSTACKTRACE_IMPL_H
@@ -0,0 +1,152 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+#include "LoggerTimers.h"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+// Self-telemetry of the logger (see Logger::getStats()): per-thread counters, merged on read
+namespace LoggerUtils{
+
+  enum class StatsTime{
+    LOGGER_LOCK_WAIT = 0, // waiting for the Logger mutex (contended acquisitions only)
+    LOGGER_LOCK_HELD,     // print statements, from the macro to the end of the statement (arguments evaluation included)
+    SINK_LOCK_WAIT,       // waiting for the sink dispatcher mutex (contended acquisitions only)
+    SINK_LOCK_HELD,       // writing to the sinks and flushing them
+    PREFIX,               // building the prefix of the lines
+    QUEUE_WAIT,           // blocked by a full output queue (compression falling behind...)
+    N_STATS_TIMES
+  };
+
+  struct SinkStats{
+    std::string name{};
+    uint64_t nbRecords{0};
+    uint64_t nbBytes{0};   // rendered lines
+    uint64_t nbDropped{0}; // lines the sink could not write (AsyncSink backlog full, SharedRingSink overruns)
+  };
+
+  struct LoggerStats{
+    static const int nLogLevels = 8;
+    static const int nTimes = static_cast<int>(StatsTime::N_STATS_TIMES);
+
+    double elapsedSeconds{0};             // since the logger started
+    uint64_t nbRecordsList[nLogLevels]{}; // per log level: FATAL=0, ERROR=1, ALERT=2, WARNING=3, INFO=4, DEBUG=5, TRACE=6
+    uint64_t nbRecords{0};
+    uint64_t nbBytes{0};                  // payloads
+    uint64_t nbFlushes{0};
+    uint64_t nbCollapsedLines{0};         // folded into "previous message repeated N times"
+    uint64_t nbDroppedLines{0};           // sum over the sinks
+    uint64_t timeNsList[nTimes]{};
+    uint64_t countList[nTimes]{};         // occurrences: contended acquisitions for the waits
+    std::vector<SinkStats> sinkList{};
+
+    uint64_t getTimeNs(StatsTime id_) const { return timeNsList[static_cast<int>(id_)]; }
+    uint64_t getCount(StatsTime id_) const { return countList[static_cast<int>(id_)]; }
+    inline uint64_t getFormatTimeNs() const; // print statements outside of the prefix and the sinks
+    inline std::string getSummaryStr() const;    // one line
+    inline std::string getPrometheusStr() const; // text exposition format
+  };
+
+  class ThreadStats{
+    // Only written by its owner thread: relaxed atomics keep concurrent reads well-defined
+  public:
+    inline void addRecord(int logLevel_, size_t nbBytes_);
+    inline void addTime(StatsTime id_, uint64_t durationNs_);
+    inline void addFlush(){ addRelaxed(_nbFlushes_, 1); }
+    inline void mergeInto(LoggerStats& stats_) const;
+    inline void moveInto(ThreadStats& total_); // adds the counters to total_ and resets them
+
+  private:
+    inline static void addRelaxed(std::atomic<uint64_t>& counter_, uint64_t value_){
+      counter_.store(counter_.load(std::memory_order_relaxed) + value_, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> _nbRecordsList_[LoggerStats::nLogLevels]{};
+    std::atomic<uint64_t> _nbBytes_{0};
+    std::atomic<uint64_t> _nbFlushes_{0};
+    std::atomic<uint64_t> _timeNsList_[LoggerStats::nTimes]{};
+    std::atomic<uint64_t> _countList_[LoggerStats::nTimes]{};
+  };
+
+  class PeriodicTrigger{
+    // fires once per interval, for the first thread claiming it
+  public:
+    inline void setInterval(double seconds_); // 0 to disable
+    inline bool claim(); // a single relaxed load while disabled
+
+  private:
+    std::atomic<uint64_t> _intervalNs_{0};
+    std::atomic<uint64_t> _nextNs_{0};
+  };
+
+  class StatsRegistry{
+    // Shared by all the source files
+  public:
+    inline StatsRegistry();
+
+    inline ThreadStats* createThreadStats();
+    inline void releaseThreadStats(ThreadStats* threadStats_); // thread exit: counted in the totals, then reused by the next threads
+    inline void mergeInto(LoggerStats& stats_);
+
+    // periodic outputs, checked when lines are dispatched
+    void setReportInterval(double seconds_){ _reportTrigger_.setInterval(seconds_); }
+    inline void setStatsFile(const std::string& filePath_, double interval_);
+    inline std::string getStatsFilePath();
+    bool claimReport(){ return _reportTrigger_.claim(); }
+    bool claimFileWrite(){ return _fileTrigger_.claim(); }
+
+    inline static bool writeStatsFile(const std::string& filePath_, const LoggerStats& stats_); // replaced at once (rename)
+
+  private:
+    std::mutex _mutex_{};
+    std::vector<std::unique_ptr<ThreadStats>> _threadStatsList_{};
+    std::vector<ThreadStats*> _freeThreadStatsList_{}; // released by the exited threads
+    ThreadStats _exitedThreadStats_{};                 // counters of the exited threads
+    const uint64_t _startNs_;
+    std::string _filePath_{};
+    PeriodicTrigger _reportTrigger_{};
+    PeriodicTrigger _fileTrigger_{};
+  };
+  inline StatsRegistry& getStatsRegistry(){ static StatsRegistry registry; return registry; }
+  inline ThreadStats& getThreadStats();
+
+  class StatsLockGuard{
+    // std::lock_guard which accounts the time spent waiting for the mutex, then holding it
+  public:
+    inline StatsLockGuard(std::mutex& mutex_, StatsTime waitId_, StatsTime heldId_);
+    inline ~StatsLockGuard();
+    StatsLockGuard(const StatsLockGuard&) = delete;
+    StatsLockGuard& operator=(const StatsLockGuard&) = delete;
+
+  private:
+    std::mutex& _mutex_;
+    StatsTime _heldId_;
+    uint64_t _lockedNs_{0};
+  };
+
+  class StatsTimeScope{
+  public:
+    inline explicit StatsTimeScope(StatsTime id_);
+    inline ~StatsTimeScope();
+    StatsTimeScope(const StatsTimeScope&) = delete;
+    StatsTimeScope& operator=(const StatsTimeScope&) = delete;
+
+  private:
+    StatsTime _id_;
+    uint64_t _startNs_{0};
+  };
+
+}
+
+#include "LoggerStats.impl.h"
@@ -0,0 +1,242 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERSTATS_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERSTATS_IMPL_H
+
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+
+
+namespace LoggerUtils{
+
+  // LoggerStats
+  inline uint64_t LoggerStats::getFormatTimeNs() const {
+    uint64_t otherNs = this->getTimeNs(StatsTime::PREFIX) + this->getTimeNs(StatsTime::SINK_LOCK_WAIT) + this->getTimeNs(StatsTime::SINK_LOCK_HELD);
+    uint64_t heldNs = this->getTimeNs(StatsTime::LOGGER_LOCK_HELD);
+    return ( heldNs > otherNs ? heldNs - otherNs : 0 );
+  }
+  inline std::string LoggerStats::getSummaryStr() const {
+    static const char* levelNameList[nLogLevels] = {"FATAL", "ERROR", "ALERT", "WARNING", "INFO", "DEBUG", "TRACE", "INVALID"};
+    auto getTimeStr = [&](StatsTime id_){ return formatDurationNs(double(this->getTimeNs(id_))); };
+
+    std::string levelsStr;
+    for( int iLevel = 0 ; iLevel < nLogLevels ; iLevel++ ){
+      if( nbRecordsList[iLevel] == 0 ) continue;
+      if( not levelsStr.empty() ) levelsStr += ", ";
+      levelsStr += std::to_string(nbRecordsList[iLevel]) + " " + levelNameList[iLevel];
+    }
+
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%.1f s", elapsedSeconds);
+    std::string out{"stats over "};
+    out += buffer;
+    out += ": " + std::to_string(nbRecords) + " records";
+    if( not levelsStr.empty() ) out += " (" + levelsStr + ")";
+    std::snprintf(buffer, sizeof(buffer), "%.1f kB", double(nbBytes) / 1E3);
+    out += ", ";
+    out += buffer;
+    out += ", " + std::to_string(nbFlushes) + " flushes";
+    out += " | statements " + getTimeStr(StatsTime::LOGGER_LOCK_HELD);
+    out += " (prefix " + getTimeStr(StatsTime::PREFIX) + ", sinks " + getTimeStr(StatsTime::SINK_LOCK_HELD) + ")";
+    out += " | waits: logger lock " + getTimeStr(StatsTime::LOGGER_LOCK_WAIT) + " (" + std::to_string(this->getCount(StatsTime::LOGGER_LOCK_WAIT)) + "x)";
+    out += ", sinks lock " + getTimeStr(StatsTime::SINK_LOCK_WAIT) + " (" + std::to_string(this->getCount(StatsTime::SINK_LOCK_WAIT)) + "x)";
+    out += ", queues " + getTimeStr(StatsTime::QUEUE_WAIT);
+    out += " | dropped " + std::to_string(nbDroppedLines) + ", collapsed " + std::to_string(nbCollapsedLines);
+    return out;
+  }
+  inline std::string LoggerStats::getPrometheusStr() const {
+    static const char* levelNameList[nLogLevels] = {"fatal", "error", "alert", "warning", "info", "debug", "trace", "invalid"};
+    static const char* timeNameList[nTimes] = {"logger_lock_wait", "logger_lock_held", "sink_lock_wait", "sink_lock_held", "prefix", "queue_wait"};
+    auto getLabelStr = [](const std::string& value_){
+      std::string out;
+      for( char c : value_ ){
+        if( c == '\\' or c == '"' ){ out += '\\'; out += c; }
+        else if( c == '\n' ){ out += "\\n"; }
+        else{ out += c; }
+      }
+      return out;
+    };
+    char buffer[64];
+    auto getSecondsStr = [&](uint64_t ns_){ std::snprintf(buffer, sizeof(buffer), "%.9f", double(ns_) / 1E9); return std::string(buffer); };
+
+    std::string out;
+    auto addHeader = [&](const char* name_, const char* type_, const char* help_){
+      out += std::string("# HELP ") + name_ + " " + help_ + "\n# TYPE " + name_ + " " + type_ + "\n";
+    };
+
+    addHeader("logger_uptime_seconds", "gauge", "Time since the logger started.");
+    std::snprintf(buffer, sizeof(buffer), "%.3f", elapsedSeconds);
+    out += std::string("logger_uptime_seconds ") + buffer + "\n";
+    addHeader("logger_records_total", "counter", "Records printed, per log level.");
+    for( int iLevel = 0 ; iLevel < nLogLevels - 1 ; iLevel++ ){
+      out += std::string("logger_records_total{level=\"") + levelNameList[iLevel] + "\"} " + std::to_string(nbRecordsList[iLevel]) + "\n";
+    }
+    addHeader("logger_payload_bytes_total", "counter", "Bytes of the printed payloads.");
+    out += "logger_payload_bytes_total " + std::to_string(nbBytes) + "\n";
+    addHeader("logger_flushes_total", "counter", "Flushes of the sinks.");
+    out += "logger_flushes_total " + std::to_string(nbFlushes) + "\n";
+    addHeader("logger_collapsed_lines_total", "counter", "Lines folded into \"previous message repeated\".");
+    out += "logger_collapsed_lines_total " + std::to_string(nbCollapsedLines) + "\n";
+    addHeader("logger_time_seconds_total", "counter", "Time spent by the logging threads, per activity.");
+    for( int iTime = 0 ; iTime < nTimes ; iTime++ ){
+      out += std::string("logger_time_seconds_total{activity=\"") + timeNameList[iTime] + "\"} " + getSecondsStr(timeNsList[iTime]) + "\n";
+    }
+    addHeader("logger_lock_contentions_total", "counter", "Lock acquisitions which had to wait.");
+    out += "logger_lock_contentions_total{lock=\"logger\"} " + std::to_string(this->getCount(StatsTime::LOGGER_LOCK_WAIT)) + "\n";
+    out += "logger_lock_contentions_total{lock=\"sinks\"} " + std::to_string(this->getCount(StatsTime::SINK_LOCK_WAIT)) + "\n";
+    addHeader("logger_sink_records_total", "counter", "Records written, per sink.");
+    for( auto& sink : sinkList ){ out += "logger_sink_records_total{sink=\"" + getLabelStr(sink.name) + "\"} " + std::to_string(sink.nbRecords) + "\n"; }
+    addHeader("logger_sink_bytes_total", "counter", "Bytes of the rendered lines, per sink.");
+    for( auto& sink : sinkList ){ out += "logger_sink_bytes_total{sink=\"" + getLabelStr(sink.name) + "\"} " + std::to_string(sink.nbBytes) + "\n"; }
+    addHeader("logger_sink_dropped_lines_total", "counter", "Lines a sink could not write.");
+    for( auto& sink : sinkList ){ out += "logger_sink_dropped_lines_total{sink=\"" + getLabelStr(sink.name) + "\"} " + std::to_string(sink.nbDropped) + "\n"; }
+    return out;
+  }
+
+  // ThreadStats
+  inline void ThreadStats::addRecord(int logLevel_, size_t nbBytes_){
+    addRelaxed(_nbRecordsList_[std::min(std::max(logLevel_, 0), LoggerStats::nLogLevels - 1)], 1);
+    addRelaxed(_nbBytes_, nbBytes_);
+  }
+  inline void ThreadStats::addTime(StatsTime id_, uint64_t durationNs_){
+    addRelaxed(_timeNsList_[static_cast<int>(id_)], durationNs_);
+    addRelaxed(_countList_[static_cast<int>(id_)], 1);
+  }
+  inline void ThreadStats::mergeInto(LoggerStats& stats_) const {
+    for( int iLevel = 0 ; iLevel < LoggerStats::nLogLevels ; iLevel++ ){
+      uint64_t nbRecords = _nbRecordsList_[iLevel].load(std::memory_order_relaxed);
+      stats_.nbRecordsList[iLevel] += nbRecords;
+      stats_.nbRecords += nbRecords;
+    }
+    stats_.nbBytes += _nbBytes_.load(std::memory_order_relaxed);
+    stats_.nbFlushes += _nbFlushes_.load(std::memory_order_relaxed);
+    for( int iTime = 0 ; iTime < LoggerStats::nTimes ; iTime++ ){
+      stats_.timeNsList[iTime] += _timeNsList_[iTime].load(std::memory_order_relaxed);
+      stats_.countList[iTime] += _countList_[iTime].load(std::memory_order_relaxed);
+    }
+  }
+
+  inline void ThreadStats::moveInto(ThreadStats& total_){
+    for( int iLevel = 0 ; iLevel < LoggerStats::nLogLevels ; iLevel++ ){
+      addRelaxed(total_._nbRecordsList_[iLevel], _nbRecordsList_[iLevel].exchange(0, std::memory_order_relaxed));
+    }
+    addRelaxed(total_._nbBytes_, _nbBytes_.exchange(0, std::memory_order_relaxed));
+    addRelaxed(total_._nbFlushes_, _nbFlushes_.exchange(0, std::memory_order_relaxed));
+    for( int iTime = 0 ; iTime < LoggerStats::nTimes ; iTime++ ){
+      addRelaxed(total_._timeNsList_[iTime], _timeNsList_[iTime].exchange(0, std::memory_order_relaxed));
+      addRelaxed(total_._countList_[iTime], _countList_[iTime].exchange(0, std::memory_order_relaxed));
+    }
+  }
+
+  // PeriodicTrigger
+  inline void PeriodicTrigger::setInterval(double seconds_){
+    auto intervalNs = static_cast<uint64_t>(seconds_ > 0 ? seconds_ * 1E9 : 0);
+    _intervalNs_.store(intervalNs, std::memory_order_relaxed);
+    _nextNs_.store(getMonotonicTimeNs() + intervalNs, std::memory_order_relaxed);
+  }
+  inline bool PeriodicTrigger::claim(){
+    uint64_t intervalNs = _intervalNs_.load(std::memory_order_relaxed);
+    if( intervalNs == 0 ) return false;
+    uint64_t nowNs = getMonotonicTimeNs();
+    auto nextNs = _nextNs_.load(std::memory_order_relaxed);
+    if( nowNs < nextNs ) return false;
+    return _nextNs_.compare_exchange_strong(nextNs, nowNs + intervalNs);
+  }
+
+  // StatsRegistry
+  inline StatsRegistry::StatsRegistry() : _startNs_(getMonotonicTimeNs()) {
+    this->setReportInterval(LOGGER_STATS_REPORT_INTERVAL);
+    this->setStatsFile(LOGGER_STATS_FILE, LOGGER_STATS_FILE_INTERVAL);
+  }
+  inline ThreadStats* StatsRegistry::createThreadStats(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( not _freeThreadStatsList_.empty() ){
+      ThreadStats* threadStats = _freeThreadStatsList_.back();
+      _freeThreadStatsList_.pop_back();
+      return threadStats;
+    }
+    _threadStatsList_.emplace_back(new ThreadStats());
+    return _threadStatsList_.back().get();
+  }
+  inline void StatsRegistry::releaseThreadStats(ThreadStats* threadStats_){
+    // under the lock: a concurrent merge doesn't count the values twice, nor miss them
+    std::lock_guard<std::mutex> lock(_mutex_);
+    threadStats_->moveInto(_exitedThreadStats_);
+    _freeThreadStatsList_.push_back(threadStats_);
+  }
+  inline void StatsRegistry::mergeInto(LoggerStats& stats_){
+    stats_.elapsedSeconds = double(getMonotonicTimeNs() - _startNs_) / 1E9;
+    std::lock_guard<std::mutex> lock(_mutex_);
+    _exitedThreadStats_.mergeInto(stats_);
+    for( auto& threadStats : _threadStatsList_ ){ threadStats->mergeInto(stats_); } // the free ones are zeroed
+  }
+
+  inline ThreadStats& getThreadStats(){
+    struct ThreadStatsSlot{
+      ThreadStats* stats{getStatsRegistry().createThreadStats()};
+      ~ThreadStatsSlot(){ getStatsRegistry().releaseThreadStats(stats); }
+    };
+    static thread_local ThreadStatsSlot slot;
+    return *slot.stats;
+  }
+  inline void StatsRegistry::setStatsFile(const std::string& filePath_, double interval_){
+    {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      _filePath_ = filePath_;
+    }
+    _fileTrigger_.setInterval(filePath_.empty() ? 0 : interval_);
+  }
+  inline std::string StatsRegistry::getStatsFilePath(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    return _filePath_;
+  }
+  inline bool StatsRegistry::writeStatsFile(const std::string& filePath_, const LoggerStats& stats_){
+    // scrapers (node_exporter textfile collector...) never see a half-written file
+    std::string tempPath{filePath_ + ".tmp"};
+    {
+      std::ofstream file{tempPath, std::ios::trunc};
+      if( not file.is_open() ) return false;
+      file << stats_.getPrometheusStr();
+      if( not file ) return false;
+    }
+    return std::rename(tempPath.c_str(), filePath_.c_str()) == 0;
+  }
+
+  // StatsLockGuard
+  inline StatsLockGuard::StatsLockGuard(std::mutex& mutex_, StatsTime waitId_, StatsTime heldId_) : _mutex_(mutex_), _heldId_(heldId_) {
+#if LOGGER_ENABLE_STATS
+    if( _mutex_.try_lock() ){ _lockedNs_ = getMonotonicTimeNs(); return; }
+    uint64_t startNs = getMonotonicTimeNs();
+    _mutex_.lock();
+    _lockedNs_ = getMonotonicTimeNs();
+    getThreadStats().addTime(waitId_, _lockedNs_ - startNs);
+#else
+    (void) waitId_;
+    _mutex_.lock();
+#endif
+  }
+  inline StatsLockGuard::~StatsLockGuard(){
+#if LOGGER_ENABLE_STATS
+    getThreadStats().addTime(_heldId_, getMonotonicTimeNs() - _lockedNs_);
+#endif
+    _mutex_.unlock();
+  }
+
+  // StatsTimeScope
+  inline StatsTimeScope::StatsTimeScope(StatsTime id_) : _id_(id_) {
+#if LOGGER_ENABLE_STATS
+    _startNs_ = getMonotonicTimeNs();
+#endif
+  }
+  inline StatsTimeScope::~StatsTimeScope(){
+#if LOGGER_ENABLE_STATS
+    getThreadStats().addTime(_id_, getMonotonicTimeNs() - _startNs_);
+#endif
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERSTATS_IMPL_H
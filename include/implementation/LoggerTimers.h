@@ -0,0 +1,103 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#pragma once
+
+
+#include "LoggerParameters.h"
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+
+
+// Scoped timers aggregated into per-thread log-linear histograms (see LogScopeTimer)
+namespace LoggerUtils{
+
+  inline uint64_t getMonotonicTimeNs(); // CLOCK_MONOTONIC (vDSO, no syscall)
+  inline std::string formatDurationNs(double durationNs_); // "12.3 us"
+
+  class TimerHistogram{
+    // Log-linear: values below 2^subBucketBits ns have their own bucket,
+    // then each power of 2 is split in 2^subBucketBits buckets (~6% resolution).
+    // Only written by its owner thread: relaxed atomics keep concurrent reads well-defined.
+  public:
+    static const int subBucketBits = 4;
+    static const int nSubBuckets = 1 << subBucketBits;
+    static const int nBuckets = nSubBuckets * (64 - subBucketBits + 1);
+
+    inline void add(uint64_t valueNs_);
+    inline void mergeInto(std::vector<uint64_t>& bucketList_, uint64_t& count_, uint64_t& sum_, uint64_t& max_) const;
+    inline void reset();
+
+    inline static int getBucketIndex(uint64_t valueNs_);
+    inline static uint64_t getBucketLowerBound(int bucketIndex_);
+    inline static uint64_t getBucketUpperBound(int bucketIndex_);
+
+  private:
+    std::atomic<uint64_t> _count_{0};
+    std::atomic<uint64_t> _sum_{0};
+    std::atomic<uint64_t> _max_{0};
+    std::atomic<uint64_t> _bucketList_[nBuckets]{};
+  };
+
+  struct TimerSummary{
+    std::string name{};
+    uint64_t count{0};
+    double meanNs{0};
+    uint64_t p50Ns{0};
+    uint64_t p99Ns{0};
+    uint64_t maxNs{0};
+  };
+
+  class TimerRegistry{
+    // Shared by all the source files
+  public:
+    inline size_t registerSite(const std::string& name_);
+    inline TimerHistogram* createThreadHistogram(size_t siteId_);
+    inline void releaseThreadHistograms(const std::vector<TimerHistogram*>& histogramList_); // thread exit: reused by the next threads
+
+    inline std::vector<TimerSummary> getSummaries();
+    inline void reset();
+
+    // periodic dump
+    inline void setDumpInterval(double seconds_);
+    inline bool isDumpDue(uint64_t nowNs_) const { return _dumpIntervalNs_.load(std::memory_order_relaxed) != 0 and nowNs_ >= _nextDumpNs_.load(std::memory_order_relaxed); }
+    inline bool claimDump(uint64_t nowNs_); // only one thread wins
+    void setDumpPending(){ _isDumpPending_.store(true, std::memory_order_relaxed); } // printed at the end of the next print statement
+    bool claimPendingDump(){ return _isDumpPending_.load(std::memory_order_relaxed) and _isDumpPending_.exchange(false); }
+
+  private:
+    struct HistogramEntry{
+      size_t siteId;
+      std::unique_ptr<TimerHistogram> histogram; // kept after the thread exits, with its counts
+    };
+
+    std::mutex _mutex_{};
+    std::vector<std::string> _siteNameList_{};
+    std::vector<HistogramEntry> _histogramList_{};
+    std::vector<std::vector<TimerHistogram*>> _freeHistogramList_{}; // per site, released by the exited threads
+    std::atomic<uint64_t> _dumpIntervalNs_{0};
+    std::atomic<uint64_t> _nextDumpNs_{0};
+    std::atomic<bool> _isDumpPending_{false};
+  };
+  inline TimerRegistry& getTimerRegistry(){ static TimerRegistry registry; return registry; }
+
+  struct TimerSite{
+    // One static instance per LogScopeTimer call
+    explicit TimerSite(const char* name_) : id(getTimerRegistry().registerSite(name_)) {}
+    const size_t id;
+  };
+
+  inline TimerHistogram& getThreadTimerHistogram(const TimerSite& site_);
+
+}
+
+#include "LoggerTimers.impl.h"
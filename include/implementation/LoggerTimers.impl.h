@@ -0,0 +1,161 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+#ifndef SIMPLE_CPP_LOGGER_LOGGERTIMERS_IMPL_H
+#define SIMPLE_CPP_LOGGER_LOGGERTIMERS_IMPL_H
+
+#include <algorithm>
+
+
+namespace LoggerUtils{
+
+  inline uint64_t getMonotonicTimeNs(){
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()
+    );
+  }
+  inline std::string formatDurationNs(double durationNs_){
+    static const char* unitList[] = {"ns", "us", "ms", "s"};
+    int iUnit{0};
+    while( iUnit < 3 and std::fabs(durationNs_) >= 1000. ){ durationNs_ /= 1000.; iUnit++; }
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.2f %s", durationNs_, unitList[iUnit]);
+    return {buffer};
+  }
+
+  // TimerHistogram
+  inline void TimerHistogram::add(uint64_t valueNs_){
+    auto& bucket = _bucketList_[getBucketIndex(valueNs_)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    _count_.store(_count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    _sum_.store(_sum_.load(std::memory_order_relaxed) + valueNs_, std::memory_order_relaxed);
+    if( valueNs_ > _max_.load(std::memory_order_relaxed) ) _max_.store(valueNs_, std::memory_order_relaxed);
+  }
+  inline void TimerHistogram::mergeInto(std::vector<uint64_t>& bucketList_, uint64_t& count_, uint64_t& sum_, uint64_t& max_) const {
+    bucketList_.resize(nBuckets, 0);
+    for( int iBucket = 0 ; iBucket < nBuckets ; iBucket++ ){ bucketList_[iBucket] += _bucketList_[iBucket].load(std::memory_order_relaxed); }
+    count_ += _count_.load(std::memory_order_relaxed);
+    sum_ += _sum_.load(std::memory_order_relaxed);
+    max_ = std::max(max_, _max_.load(std::memory_order_relaxed));
+  }
+  inline void TimerHistogram::reset(){
+    for( auto& bucket : _bucketList_ ){ bucket.store(0, std::memory_order_relaxed); }
+    _count_.store(0, std::memory_order_relaxed);
+    _sum_.store(0, std::memory_order_relaxed);
+    _max_.store(0, std::memory_order_relaxed);
+  }
+  inline int TimerHistogram::getBucketIndex(uint64_t valueNs_){
+    if( valueNs_ < uint64_t(nSubBuckets) ) return int(valueNs_);
+#if defined(__GNUC__) || defined(__clang__)
+    int log2Value = 63 - __builtin_clzll(valueNs_);
+#else
+    int log2Value = 0;
+    while( (valueNs_ >> (log2Value + 1)) != 0 ){ log2Value++; }
+#endif
+    int subBucket = int((valueNs_ >> (log2Value - subBucketBits)) & (nSubBuckets - 1));
+    return (log2Value - subBucketBits + 1) * nSubBuckets + subBucket;
+  }
+  inline uint64_t TimerHistogram::getBucketLowerBound(int bucketIndex_){
+    if( bucketIndex_ < nSubBuckets ) return uint64_t(bucketIndex_);
+    int log2Value = bucketIndex_ / nSubBuckets + subBucketBits - 1;
+    uint64_t subBucket = uint64_t(bucketIndex_ % nSubBuckets);
+    return (uint64_t(1) << log2Value) + (subBucket << (log2Value - subBucketBits));
+  }
+  inline uint64_t TimerHistogram::getBucketUpperBound(int bucketIndex_){
+    if( bucketIndex_ + 1 >= nBuckets ) return UINT64_MAX;
+    return getBucketLowerBound(bucketIndex_ + 1) - 1;
+  }
+
+  // TimerRegistry
+  inline size_t TimerRegistry::registerSite(const std::string& name_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    // several call sites can feed the same timer
+    for( size_t iSite = 0 ; iSite < _siteNameList_.size() ; iSite++ ){
+      if( _siteNameList_[iSite] == name_ ) return iSite;
+    }
+    _siteNameList_.emplace_back(name_);
+    return _siteNameList_.size() - 1;
+  }
+  inline TimerHistogram* TimerRegistry::createThreadHistogram(size_t siteId_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( siteId_ < _freeHistogramList_.size() and not _freeHistogramList_[siteId_].empty() ){
+      // the new owner keeps adding to the counts of the exited thread: the memory stays bounded by the live threads
+      TimerHistogram* histogram = _freeHistogramList_[siteId_].back();
+      _freeHistogramList_[siteId_].pop_back();
+      return histogram;
+    }
+    _histogramList_.push_back({siteId_, std::unique_ptr<TimerHistogram>(new TimerHistogram())});
+    return _histogramList_.back().histogram.get();
+  }
+  inline void TimerRegistry::releaseThreadHistograms(const std::vector<TimerHistogram*>& histogramList_){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    if( _freeHistogramList_.size() < histogramList_.size() ) _freeHistogramList_.resize(histogramList_.size());
+    for( size_t iSite = 0 ; iSite < histogramList_.size() ; iSite++ ){
+      if( histogramList_[iSite] != nullptr ) _freeHistogramList_[iSite].push_back(histogramList_[iSite]);
+    }
+  }
+  inline std::vector<TimerSummary> TimerRegistry::getSummaries(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+
+    std::vector<TimerSummary> out(_siteNameList_.size());
+    std::vector<std::vector<uint64_t>> bucketsPerSite(_siteNameList_.size());
+    std::vector<uint64_t> sumPerSite(_siteNameList_.size(), 0);
+    for( auto& entry : _histogramList_ ){
+      auto& summary = out[entry.siteId];
+      entry.histogram->mergeInto(bucketsPerSite[entry.siteId], summary.count, sumPerSite[entry.siteId], summary.maxNs);
+    }
+
+    for( size_t iSite = 0 ; iSite < out.size() ; iSite++ ){
+      auto& summary = out[iSite];
+      summary.name = _siteNameList_[iSite];
+      if( summary.count == 0 ) continue;
+      summary.meanNs = double(sumPerSite[iSite]) / double(summary.count);
+
+      // percentiles: upper edge of the bucket where the cumulated count crosses the threshold
+      auto getPercentile = [&](double fraction_){
+        auto threshold = static_cast<uint64_t>(std::ceil(fraction_ * double(summary.count)));
+        uint64_t cumulated{0};
+        for( int iBucket = 0 ; iBucket < TimerHistogram::nBuckets ; iBucket++ ){
+          cumulated += bucketsPerSite[iSite][iBucket];
+          if( cumulated >= threshold ) return std::min(TimerHistogram::getBucketUpperBound(iBucket), summary.maxNs);
+        }
+        return summary.maxNs;
+      };
+      summary.p50Ns = getPercentile(0.50);
+      summary.p99Ns = getPercentile(0.99);
+    }
+
+    out.erase(std::remove_if(out.begin(), out.end(), [](const TimerSummary& s_){ return s_.count == 0; }), out.end());
+    return out;
+  }
+  inline void TimerRegistry::reset(){
+    std::lock_guard<std::mutex> lock(_mutex_);
+    for( auto& entry : _histogramList_ ){ entry.histogram->reset(); }
+  }
+  inline void TimerRegistry::setDumpInterval(double seconds_){
+    auto intervalNs = static_cast<uint64_t>(seconds_ > 0 ? seconds_ * 1E9 : 0);
+    _dumpIntervalNs_.store(intervalNs, std::memory_order_relaxed);
+    _nextDumpNs_.store(getMonotonicTimeNs() + intervalNs, std::memory_order_relaxed);
+  }
+  inline bool TimerRegistry::claimDump(uint64_t nowNs_){
+    auto nextDump = _nextDumpNs_.load(std::memory_order_relaxed);
+    if( nowNs_ < nextDump ) return false;
+    return _nextDumpNs_.compare_exchange_strong(nextDump, nowNs_ + _dumpIntervalNs_.load(std::memory_order_relaxed));
+  }
+
+  inline TimerHistogram& getThreadTimerHistogram(const TimerSite& site_){
+    struct ThreadHistograms{
+      std::vector<TimerHistogram*> list;
+      ~ThreadHistograms(){ getTimerRegistry().releaseThreadHistograms(list); }
+    };
+    static thread_local ThreadHistograms histograms;
+    auto& histogramList = histograms.list;
+    if( site_.id >= histogramList.size() ) histogramList.resize(site_.id + 1, nullptr);
+    if( histogramList[site_.id] == nullptr ) histogramList[site_.id] = getTimerRegistry().createThreadHistogram(site_.id);
+    return *histogramList[site_.id];
+  }
+
+}
+
+#endif //SIMPLE_CPP_LOGGER_LOGGERTIMERS_IMPL_H
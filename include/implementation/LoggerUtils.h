@@ -6,10 +6,17 @@
 
 
 #include "LoggerMacros.h"
+#include "LoggerParameters.h"
+#include "LoggerTimers.h"
 
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <memory>
 #include <thread>
 #include <vector>
 #include <string>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <functional>
@@ -30,9 +37,6 @@ namespace LoggerUtils{
       _outputStream_->rdbuf(this);          // reassign your streambuf to cout
     }
     ~StreamBufferSupervisor() override {
-      if( _outFileStream_.is_open() ){
-        _outFileStream_.close();
-      }
       _outputStream_->rdbuf(_streamBufferPtr_);
     }
 
@@ -41,37 +45,40 @@ namespace LoggerUtils{
       // no buffering, overflow on every char
       setp(nullptr, nullptr);
     }
-    const char& getLastChar() const { return _lastChar_; }
+    char getLastChar() const { return _lastChar_.load(std::memory_order_relaxed); }
     int_type overflow(int_type c) override {
       if( _streamBufferPtr_ != nullptr ) _streamBufferPtr_->sputc(char(c));
-      _lastChar_ = char(c);
+      _lastChar_.store(char(c), std::memory_order_relaxed);
       return c;
     }
-
-    void openOutFileStream(const std::string& outFilePath_){
-      _outFileStream_.open(outFilePath_);
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+      // whole chunks are forwarded at once
+      if( n <= 0 ) return 0;
+      if( _streamBufferPtr_ != nullptr ) _streamBufferPtr_->sputn(s, n);
+      _lastChar_.store(s[n - 1], std::memory_order_relaxed);
+      return n;
+    }
+    int sync() override {
+      return ( _streamBufferPtr_ != nullptr ? _streamBufferPtr_->pubsync() : 0 );
     }
+
     template<typename T> StreamBufferSupervisor& operator<<(const T& something){
       (*_outputStream_) << something;
-      if( _outFileStream_.is_open() ) _outFileStream_ << something;
       return *this;
     }
     StreamBufferSupervisor &operator<<(std::ostream &(*f)(std::ostream &)){
       (*_outputStream_) << f;
-      if( _outFileStream_.is_open() ) _outFileStream_ << f;
       return *this;
     }
     StreamBufferSupervisor &flush(){
          if(*_outputStream_) _outputStream_->flush();
-         if(_outFileStream_.is_open()) _outFileStream_.flush();
          return *this;
     }
 
   private:
     std::streambuf* _streamBufferPtr_{nullptr};
-    std::ofstream _outFileStream_;
     std::ostream* _outputStream_ = &std::cout;
-    char _lastChar_{static_cast<char>(traits_type::eof())};
+    std::atomic<char> _lastChar_{static_cast<char>(traits_type::eof())}; // also written by the AsyncSink thread
   };
 
   //! String Utils
@@ -79,6 +86,7 @@ namespace LoggerUtils{
   inline std::string padString(const std::string& inputStr_, const unsigned int &padSize_, const char& padChar = ' ');
   inline std::string toLowerCase(const std::string &inputStr_);
   inline std::string stripStringUnicode(const std::string &inputStr_);
+  inline void stripAnsiEscapeCodes(const std::string &inputStr_, std::string &outputStr_);
   inline std::string repeatString(const std::string &inputStr_, int amount_);
   inline std::vector<std::string> splitString(const std::string& input_string_, const std::string& delimiter_);
   inline std::string formatString( const std::string& strToFormat_ ); // 0 args overrider
@@ -89,8 +97,71 @@ namespace LoggerUtils{
 
   // Hardware Utils
   inline int getTerminalWidth();
+  inline int getCachedTerminalWidth(); // only queries the terminal again after a SIGWINCH
+  inline bool isTerminalOutput();      // stdout is a TTY
   inline std::string getExecutableName();
 
+  // Process Utils: each call reads the values from the system
+  inline long getProcessId();
+  inline uint64_t getResidentMemoryBytes(); // RSS
+  inline double getProcessCpuSeconds();     // user + system, all the threads
+  inline std::string formatByteSize(uint64_t nBytes_); // "512.3 MB"
+  struct ResourceSample{
+    long pid{0};
+    uint64_t residentBytes{0};
+    double cpuSeconds{0};
+  };
+  // For the {PID}, {RSS} and {CPU} prefix tokens: sampled at most every LOGGER_RESOURCE_SAMPLING_PERIOD ms, whatever the number of lines
+  inline ResourceSample getCachedResourceSample();
+
+  // Thread Utils
+  struct ThreadIdentity{
+    // Built once per thread, so the prefix doesn't have to format the thread id on each line
+    uint32_t number{0};          // compact sequential number, in order of first use
+    uint32_t slot{0};            // reused once the thread exits: index of the per-thread tables, which stay bounded
+    long kernelId{0};            // gettid() on linux
+    std::string name{};          // set with Logger::setThreadName()
+    std::string renderedNumber{};
+    std::string renderedKernelId{};
+  };
+  inline ThreadIdentity& getThreadIdentity();
+  // Logger objects alive in the calling thread, whatever their source file: while not 0, the thread holds a logger mutex
+  inline int& getThreadStatementDepth(){ static thread_local int depth{0}; return depth; }
+  inline long getKernelThreadId();
+  inline void setThreadName(const std::string& threadName_);
+  inline std::string getThreadName(uint32_t threadNumber_); // lookup in the registry, for any thread
+
+  // Publication Utils
+  template<typename T> class AtomicSharedPtr{
+    // std::shared_ptr loaded and replaced atomically: std::atomic<std::shared_ptr> when the library has it (C++20)
+  public:
+    explicit AtomicSharedPtr(std::shared_ptr<T> ptr_) : _ptr_(std::move(ptr_)) {}
+    AtomicSharedPtr(const AtomicSharedPtr&) = delete;
+    AtomicSharedPtr& operator=(const AtomicSharedPtr&) = delete;
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::shared_ptr<T> load() const { return _ptr_.load(std::memory_order_acquire); }
+    void store(std::shared_ptr<T> ptr_){ _ptr_.store(std::move(ptr_), std::memory_order_release); }
+  private:
+    std::atomic<std::shared_ptr<T>> _ptr_;
+#else
+    std::shared_ptr<T> load() const { return std::atomic_load_explicit(&_ptr_, std::memory_order_acquire); }
+    void store(std::shared_ptr<T> ptr_){ std::atomic_store_explicit(&_ptr_, std::move(ptr_), std::memory_order_release); }
+  private:
+    std::shared_ptr<T> _ptr_;
+#endif
+  };
+
+  // Call site Utils
+  struct CallSite{
+    // Static descriptor of a LogThrowIf/LogAssert... call: constant-initialized, nothing is done at the call site until the check fails
+    const char* filePath;
+    int lineNumber;
+    const char* functionName;
+    const char* conditionStr;
+
+    inline const char* getFileName() const; // without the folders, as FILENAME
+  };
+
   // hash Utils
   template <class T> inline void hashCombine(std::size_t& seed, const T& v) {
     std::hash<T> hasher;
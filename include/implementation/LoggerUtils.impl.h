@@ -18,6 +18,7 @@
 // Windows
 #include <windows.h>
 #include <psapi.h>
+#include <io.h>
 #define WIN32_LEAN_AND_MEAN
 #define VC_EXTRALEAN
 #include <Windows.h>
@@ -27,6 +28,7 @@
 #include <sys/resource.h>
 #include <mach/mach.h>
 #include <sys/ioctl.h>
+#include <pthread.h>
 #include <Logger.h>
 
 #elif defined(__linux__) || defined(__linux) || defined(linux) || defined(__gnu_linux__)
@@ -34,7 +36,9 @@
 #include <unistd.h>
 #include <sys/time.h>
 #include <sys/resource.h>
+#include <sys/syscall.h>
 #include <stdio.h>
+#include <pthread.h>
 #include <sys/ioctl.h>
 
 #elif (defined(_AIX) || defined(__TOS__AIX__)) || (defined(__sun__) || defined(__sun) || defined(sun) && (defined(__SVR4) || defined(__svr4__)))
@@ -43,6 +47,7 @@
 #include <sys/resource.h>
 #include <fcntl.h>
 #include <procfs.h>
+#include <pthread.h>
 #include <sys/ioctl.h>
 
 #else
@@ -50,6 +55,7 @@
 #endif
 
 #include <cstdio>
+#include <csignal>
 #include <cstdlib>
 extern char* __progname;
 
@@ -128,6 +134,17 @@ namespace LoggerUtils{
 
     return outputStr;
   }
+  inline void stripAnsiEscapeCodes(const std::string &inputStr_, std::string &outputStr_){
+    // ESC '[' parameters... final byte in [@-~]
+    outputStr_.clear();
+    for( size_t iChar = 0 ; iChar < inputStr_.size() ; iChar++ ){
+      if( inputStr_[iChar] != '\033' ){ outputStr_ += inputStr_[iChar]; continue; }
+      if( iChar + 1 < inputStr_.size() and inputStr_[iChar + 1] == '[' ){
+        iChar += 2;
+        while( iChar < inputStr_.size() and (inputStr_[iChar] < '@' or inputStr_[iChar] > '~') ){ iChar++; }
+      }
+    }
+  }
   inline std::string repeatString(const std::string &inputStr_, int amount_){
     std::string outputStr;
     if(amount_ <= 0) return outputStr;
@@ -193,7 +210,7 @@ namespace LoggerUtils{
 
   // Hardware related tools
   inline int getTerminalWidth(){
-    int outWith;
+    int outWith{0};
 #if defined(_WIN32)
     CONSOLE_SCREEN_BUFFER_INFO csbi;
       GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &csbi);
@@ -209,6 +226,54 @@ namespace LoggerUtils{
 #endif // Windows/Linux
     return outWith;
   }
+  namespace TerminalState{
+    inline std::atomic<int>& getWidth(){ static std::atomic<int> width{0}; return width; }
+    inline volatile std::sig_atomic_t& getIsResized(){ static volatile std::sig_atomic_t isResized{1}; return isResized; }
+    inline std::atomic<bool>& getHasProgressLine(){ static std::atomic<bool> hasProgressLine{false}; return hasProgressLine; }
+    inline bool consumeProgressLine(){
+      auto& hasProgressLine = getHasProgressLine();
+      return hasProgressLine.load(std::memory_order_relaxed) and hasProgressLine.exchange(false, std::memory_order_relaxed);
+    }
+#if defined(SIGWINCH)
+    inline struct sigaction& getPreviousAction(){ static struct sigaction previousAction{}; return previousAction; }
+    inline void onResize(int signal_){
+      getIsResized() = 1;
+      // don't steal the signal from the application
+      auto& previousAction = getPreviousAction();
+      if( not (previousAction.sa_flags & SA_SIGINFO)
+          and previousAction.sa_handler != SIG_DFL and previousAction.sa_handler != SIG_IGN ){
+        previousAction.sa_handler(signal_);
+      }
+    }
+#endif
+  }
+  inline int getCachedTerminalWidth(){
+#if defined(SIGWINCH)
+    static bool isHandlerInstalled = []{
+      struct sigaction action{};
+      action.sa_handler = &TerminalState::onResize;
+      sigemptyset(&action.sa_mask);
+      action.sa_flags = SA_RESTART;
+      return sigaction(SIGWINCH, &action, &TerminalState::getPreviousAction()) == 0;
+    }();
+    (void) isHandlerInstalled;
+#endif
+    auto& isResized = TerminalState::getIsResized();
+    if( isResized ){
+      isResized = 0;
+      int width = getTerminalWidth();
+      TerminalState::getWidth().store(width > 0 ? width : 80, std::memory_order_relaxed);
+    }
+    return TerminalState::getWidth().load(std::memory_order_relaxed);
+  }
+  inline bool isTerminalOutput(){
+#if defined(_WIN32)
+    static const bool isTerminal = _isatty(_fileno(stdout)) != 0;
+#else
+    static const bool isTerminal = isatty(fileno(stdout)) != 0;
+#endif
+    return isTerminal;
+  }
   inline std::string getExecutableName(){
     std::string outStr;
 #if defined(__linux__) || defined(__linux) || defined(linux) || defined(__gnu_linux__) //check defines for your setup
@@ -225,6 +290,177 @@ namespace LoggerUtils{
     return outStr;
   }
 
+  // Process Utils
+  inline long getProcessId(){
+#if defined(_WIN32)
+    return long(GetCurrentProcessId());
+#elif defined(__SWITCH__)
+    return 0;
+#else
+    return long(getpid());
+#endif
+  }
+  inline uint64_t getResidentMemoryBytes(){
+    uint64_t out{0};
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if( GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ) out = uint64_t(counters.WorkingSetSize);
+#elif defined(__APPLE__) && defined(__MACH__)
+    struct mach_task_basic_info info;
+    mach_msg_type_number_t infoCount = MACH_TASK_BASIC_INFO_COUNT;
+    if( task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t) &info, &infoCount) == KERN_SUCCESS ) out = uint64_t(info.resident_size);
+#elif defined(__linux__) || defined(__linux) || defined(linux) || defined(__gnu_linux__)
+    // second field: resident pages
+    FILE* file = fopen("/proc/self/statm", "r");
+    if( file != nullptr ){
+      unsigned long nPages{0};
+      if( fscanf(file, "%*s %lu", &nPages) == 1 ) out = uint64_t(nPages) * uint64_t(sysconf(_SC_PAGESIZE));
+      fclose(file);
+    }
+#elif (defined(_AIX) || defined(__TOS__AIX__)) || (defined(__sun__) || defined(__sun) || defined(sun) && (defined(__SVR4) || defined(__svr4__)))
+    struct psinfo info;
+    int fd = open("/proc/self/psinfo", O_RDONLY);
+    if( fd != -1 ){
+      if( read(fd, &info, sizeof(info)) == sizeof(info) ) out = uint64_t(info.pr_rssize) * 1024;
+      close(fd);
+    }
+#endif
+    return out;
+  }
+  inline double getProcessCpuSeconds(){
+#if defined(_WIN32)
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if( not GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime) ) return 0;
+    auto toSeconds = [](const FILETIME& time_){ return double((uint64_t(time_.dwHighDateTime) << 32) | time_.dwLowDateTime) / 1E7; }; // 100 ns ticks
+    return toSeconds(kernelTime) + toSeconds(userTime);
+#elif defined(__SWITCH__)
+    return 0;
+#else
+    struct rusage usage{};
+    if( getrusage(RUSAGE_SELF, &usage) != 0 ) return 0;
+    return double(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + double(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1E6;
+#endif
+  }
+  inline std::string formatByteSize(uint64_t nBytes_){
+    static const char* unitList[] = {"B", "kB", "MB", "GB", "TB"};
+    double size = double(nBytes_);
+    int iUnit{0};
+    while( iUnit < 4 and size >= 1000. ){ size /= 1000.; iUnit++; }
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), ( iUnit == 0 ? "%.0f %s" : "%.1f %s" ), size, unitList[iUnit]);
+    return {buffer};
+  }
+  namespace ResourceSampler{
+    // shared by all the source files: the Loggers of different source files print concurrently
+    inline std::atomic<uint64_t>& getNextSampleNs(){ static std::atomic<uint64_t> nextSampleNs{0}; return nextSampleNs; }
+    inline std::atomic<long>& getPid(){ static std::atomic<long> pid{0}; return pid; }
+    inline std::atomic<uint64_t>& getResidentBytes(){ static std::atomic<uint64_t> residentBytes{0}; return residentBytes; }
+    inline std::atomic<uint64_t>& getCpuNs(){ static std::atomic<uint64_t> cpuNs{0}; return cpuNs; }
+    inline void refreshPid(){ getPid().store(getProcessId(), std::memory_order_relaxed); }
+    inline void takeSample(){
+      getResidentBytes().store(getResidentMemoryBytes(), std::memory_order_relaxed);
+      getCpuNs().store(uint64_t(getProcessCpuSeconds() * 1E9), std::memory_order_relaxed);
+    }
+    inline void initialize(){
+      // once, by the first line printed: it shows actual values instead of zeros. The PID only changes with fork().
+      static bool isInitialized = []{
+        refreshPid();
+        takeSample();
+        getNextSampleNs().store(getMonotonicTimeNs() + uint64_t(LOGGER_RESOURCE_SAMPLING_PERIOD) * 1000000, std::memory_order_relaxed);
+#if !defined(_WIN32) && !defined(__SWITCH__)
+        pthread_atfork(nullptr, nullptr, &refreshPid);
+#endif
+        return true;
+      }();
+      (void) isInitialized;
+    }
+  }
+  inline ResourceSample getCachedResourceSample(){
+    // the first thread to see the period elapsed reads the new values, the others keep the previous ones
+    ResourceSampler::initialize();
+    uint64_t nowNs = getMonotonicTimeNs();
+    auto& nextSampleNs = ResourceSampler::getNextSampleNs();
+    uint64_t nextNs = nextSampleNs.load(std::memory_order_relaxed);
+    if( nowNs >= nextNs and nextSampleNs.compare_exchange_strong(nextNs, nowNs + uint64_t(LOGGER_RESOURCE_SAMPLING_PERIOD) * 1000000) ){
+      ResourceSampler::takeSample();
+    }
+
+    ResourceSample out;
+    out.pid = ResourceSampler::getPid().load(std::memory_order_relaxed);
+    out.residentBytes = ResourceSampler::getResidentBytes().load(std::memory_order_relaxed);
+    out.cpuSeconds = double(ResourceSampler::getCpuNs().load(std::memory_order_relaxed)) / 1E9;
+    return out;
+  }
+
+  // Thread Utils
+  namespace ThreadRegistry{
+    // shared by all the source files (inline functions have a unique instance of their static variables)
+    inline std::atomic<uint32_t>& getThreadCounter(){ static std::atomic<uint32_t> counter{0}; return counter; }
+    inline std::mutex& getMutex(){ static std::mutex mutex; return mutex; }
+    inline std::map<uint32_t, std::string>& getThreadNameMap(){ static std::map<uint32_t, std::string> nameMap; return nameMap; }
+    inline std::vector<uint32_t>& getFreeSlotList(){ static std::vector<uint32_t> slotList; return slotList; }
+    inline uint32_t acquireSlot(){
+      static uint32_t nbSlots{0};
+      std::lock_guard<std::mutex> lock(getMutex());
+      if( getFreeSlotList().empty() ) return nbSlots++;
+      uint32_t slot = getFreeSlotList().back();
+      getFreeSlotList().pop_back();
+      return slot;
+    }
+    struct ThreadSlot{
+      // thread_local: the slot goes back to the free list when the thread exits
+      ThreadSlot() : index(acquireSlot()) {}
+      ~ThreadSlot(){
+        std::lock_guard<std::mutex> lock(getMutex());
+        getFreeSlotList().push_back(index);
+      }
+      const uint32_t index;
+    };
+  }
+  inline ThreadIdentity& getThreadIdentity(){
+    static thread_local ThreadIdentity identity = []{
+      ThreadIdentity out;
+      static thread_local ThreadRegistry::ThreadSlot threadSlot;
+      out.number = ThreadRegistry::getThreadCounter().fetch_add(1, std::memory_order_relaxed);
+      out.slot = threadSlot.index;
+      out.kernelId = getKernelThreadId();
+      out.renderedNumber = std::to_string(out.number);
+      out.renderedKernelId = std::to_string(out.kernelId);
+      return out;
+    }();
+    return identity;
+  }
+  inline long getKernelThreadId(){
+#if defined(__linux__) || defined(__linux) || defined(linux) || defined(__gnu_linux__)
+    return static_cast<long>(syscall(SYS_gettid));
+#elif defined(__APPLE__) && defined(__MACH__)
+    uint64_t threadId{0};
+    pthread_threadid_np(nullptr, &threadId);
+    return static_cast<long>(threadId);
+#elif defined(_WIN32)
+    return static_cast<long>(GetCurrentThreadId());
+#else
+    return 0;
+#endif
+  }
+  inline void setThreadName(const std::string& threadName_){
+    auto& identity = getThreadIdentity();
+    identity.name = threadName_;
+    std::lock_guard<std::mutex> lock(ThreadRegistry::getMutex());
+    ThreadRegistry::getThreadNameMap()[identity.number] = threadName_;
+  }
+  inline std::string getThreadName(uint32_t threadNumber_){
+    std::lock_guard<std::mutex> lock(ThreadRegistry::getMutex());
+    auto it = ThreadRegistry::getThreadNameMap().find(threadNumber_);
+    return ( it != ThreadRegistry::getThreadNameMap().end() ? it->second : std::string() );
+  }
+
+  // Call site Utils
+  inline const char* CallSite::getFileName() const {
+    const char* lastSlash = strrchr(filePath, '/');
+    return ( lastSlash != nullptr ? lastSlash + 1 : filePath );
+  }
+
 }
 
 #endif //SIMPLE_CPP_LOGGER_LOGGERUTILS_IMPL_H
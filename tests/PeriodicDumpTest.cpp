@@ -0,0 +1,121 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+// Periodic dumps of LogStat and LogScopeTimer claimed while the thread holds the logger mutex, in the arguments of a print statement:
+// the summary has to wait for the end of the statement instead of locking the mutex again (deadlock).
+// A deadlock shows up as a ctest timeout.
+
+#include "Logger.h"
+
+#include <mutex>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+
+
+namespace {
+
+  int nFailures{0};
+
+  void check(bool isOk_, const std::string& what_){
+    if( isOk_ ) return;
+    std::fprintf(stderr, "FAILED: %s\n", what_.c_str());
+    nFailures++;
+  }
+
+  class CaptureSink : public LoggerUtils::LogSink{
+    // payloads of the printed lines, pieces gathered
+  public:
+    void write(const LoggerUtils::LogRecord& record_) override {
+      std::lock_guard<std::mutex> lock(_mutex_);
+      _currentLine_ += record_.payload;
+      if( record_.terminator == '\0' ) return;
+      _lineList_.push_back(_currentLine_);
+      _currentLine_.clear();
+    }
+    std::vector<std::string> takeLines(){
+      std::lock_guard<std::mutex> lock(_mutex_);
+      std::vector<std::string> out;
+      out.swap(_lineList_);
+      return out;
+    }
+
+  private:
+    std::mutex _mutex_{};
+    std::string _currentLine_{};
+    std::vector<std::string> _lineList_{};
+  };
+
+  int readValue(int value_){
+    LogStat("test.value", value_);
+    return value_;
+  }
+
+  int computeValue(int value_){
+    LogScopeTimer("test.compute");
+    return value_;
+  }
+
+  void waitDumpInterval(){ std::this_thread::sleep_for(std::chrono::milliseconds(60)); }
+
+  bool startsWith(const std::string& str_, const std::string& start_){ return str_.compare(0, start_.size(), start_) == 0; }
+
+}
+
+int main(){
+
+  auto sink = std::make_shared<CaptureSink>();
+  Logger::addSink(sink, "capture");
+
+  // LogStat alone: flagged, printed by the next print statement
+  Logger::setMetricsDumpInterval(0.05);
+  readValue(1);
+  waitDumpInterval();
+  readValue(2);
+  check(sink->takeLines().empty(), "LogStat doesn't print");
+  LogInfo << "next statement" << std::endl;
+  auto lineList = sink->takeLines();
+  check(lineList.size() == 2, "summary printed after the next statement, got " + std::to_string(lineList.size()) + " lines");
+  if( lineList.size() == 2 ){
+    check(lineList[0] == "next statement", "statement first, got \"" + lineList[0] + "\"");
+    check(startsWith(lineList[1], "test.value: 2 values"), "summary, got \"" + lineList[1] + "\"");
+  }
+
+  // LogStat evaluated while the logger mutex is held
+  waitDumpInterval();
+  LogInfo << "value: " << readValue(3) << std::endl;
+  lineList = sink->takeLines();
+  check(lineList.size() == 2, "LogStat in a print statement, got " + std::to_string(lineList.size()) + " lines");
+  if( lineList.size() == 2 ){
+    check(lineList[0] == "value: 3", "statement first, got \"" + lineList[0] + "\"");
+    check(startsWith(lineList[1], "test.value: 1 values"), "summary, got \"" + lineList[1] + "\"");
+  }
+
+  // LogScopeTimer left while the logger mutex is held
+  Logger::setMetricsDumpInterval(0);
+  Logger::setTimersDumpInterval(0.05);
+  waitDumpInterval();
+  LogInfo << "computed: " << computeValue(4) << std::endl;
+  lineList = sink->takeLines();
+  check(lineList.size() == 4, "LogScopeTimer in a print statement, got " + std::to_string(lineList.size()) + " lines");
+  if( lineList.size() == 4 ){
+    check(lineList[0] == "computed: 4", "statement first, got \"" + lineList[0] + "\"");
+    check(lineList[1] == "Timers summary:", "timers table, got \"" + lineList[1] + "\"");
+  }
+
+  // LogScopeTimer outside of any print statement: printed right away
+  Logger::resetTimers();
+  waitDumpInterval();
+  computeValue(5);
+  lineList = sink->takeLines();
+  check(lineList.size() == 3 and lineList[0] == "Timers summary:", "timers table printed when leaving the scope");
+
+  Logger::removeSink("capture");
+  if( nFailures != 0 ){ std::fprintf(stderr, "%d check(s) failed\n", nFailures); return EXIT_FAILURE; }
+  std::printf("PeriodicDump: all checks passed\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,198 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+// LoggerUtils::SyslogSink against a local datagram socket standing for the log daemon:
+// RFC 3164 header of each line, lines held until the batch is full, synced or old enough, pieces of line gathered.
+
+#define LOGGER_SYSLOG_FLUSH_PERIOD 1 // longer than the wait of DaemonSocket::takeMessages()
+
+#include "Logger.h"
+
+#include <ctime>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+
+
+namespace {
+
+  int nFailures{0};
+
+  void check(bool isOk_, const std::string& what_){
+    if( isOk_ ) return;
+    std::fprintf(stderr, "FAILED: %s\n", what_.c_str());
+    nFailures++;
+  }
+
+  class DaemonSocket{
+    // Receiving end, read by a thread as the daemon would: the socket queue is short (net.unix.max_dgram_qlen),
+    // a full batch doesn't fit in it.
+  public:
+    explicit DaemonSocket(const std::string& path_) : _path_(path_) {
+      ::unlink(_path_.c_str());
+      struct sockaddr_un address{};
+      address.sun_family = AF_UNIX;
+      std::strncpy(address.sun_path, _path_.c_str(), sizeof(address.sun_path) - 1);
+      _socket_ = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+      if( _socket_ < 0 ) return;
+      if( ::bind(_socket_, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0 ){
+        ::close(_socket_);
+        _socket_ = -1;
+        return;
+      }
+      struct timeval timeout{0, 20000}; // the thread checks _isStopping_ at least every 20 ms
+      ::setsockopt(_socket_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+      _receiverThread_ = std::thread([this]{ this->receiveLoop(); });
+    }
+    ~DaemonSocket(){
+      _isStopping_ = true;
+      if( _receiverThread_.joinable() ) _receiverThread_.join();
+      if( _socket_ >= 0 ) ::close(_socket_);
+      ::unlink(_path_.c_str());
+    }
+
+    bool isOpen() const { return _socket_ >= 0; }
+    std::vector<std::string> takeMessages(){
+      // once nothing arrived for 100 ms: an empty list means the lines are still held by the sink
+      size_t nMessages{0};
+      for( int iWait = 0 ; iWait < 50 ; iWait++ ){
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        std::lock_guard<std::mutex> lock(_mutex_);
+        if( _messageList_.size() == nMessages ) break;
+        nMessages = _messageList_.size();
+      }
+      std::lock_guard<std::mutex> lock(_mutex_);
+      std::vector<std::string> out;
+      out.swap(_messageList_);
+      return out;
+    }
+
+  private:
+    void receiveLoop(){
+      std::vector<char> buffer(LOGGER_SYSLOG_MAX_MESSAGE_SIZE + 1);
+      while( not _isStopping_ ){
+        auto size = ::recv(_socket_, buffer.data(), buffer.size(), 0);
+        if( size < 0 ) continue; // timeout
+        std::lock_guard<std::mutex> lock(_mutex_);
+        _messageList_.emplace_back(buffer.data(), size_t(size));
+      }
+    }
+
+    std::string _path_;
+    int _socket_{-1};
+    std::atomic<bool> _isStopping_{false};
+    std::mutex _mutex_{};
+    std::vector<std::string> _messageList_{};
+    std::thread _receiverThread_{};
+  };
+
+  LoggerUtils::LogRecord buildRecord(int logLevel_, const std::string& payload_, char terminator_ = '\n'){
+    LoggerUtils::LogRecord record;
+    record.logLevel = logLevel_;
+    record.timestamp = uint64_t(std::time(nullptr)) * 1000000000ULL;
+    record.coloredPrefix = "\x1b[31mERROR\x1b[0m: "; // not sent: the daemon adds its own
+    record.plainPrefix = "ERROR: ";
+    record.payload = payload_;
+    record.terminator = terminator_;
+    return record;
+  }
+
+  std::string buildExpectedMessage(const LoggerUtils::LogRecord& record_, int priority_, const std::string& ident_, const std::string& message_){
+    char header[64];
+    auto seconds = static_cast<time_t>(record_.timestamp / 1000000000ULL);
+    struct tm localTime{};
+    localtime_r(&seconds, &localTime);
+    int size = std::snprintf(header, sizeof(header), "<%d>", priority_);
+    size += int(std::strftime(header + size, sizeof(header) - size_t(size), "%b %e %H:%M:%S ", &localTime));
+    return std::string(header, size_t(size)) + ident_ + "[" + std::to_string(::getpid()) + "]: " + message_;
+  }
+
+}
+
+int main(){
+
+  std::string socketPath{"/tmp/LoggerSyslogSinkTest_" + std::to_string(::getpid()) + ".sock"};
+  DaemonSocket daemon(socketPath);
+  if( not daemon.isOpen() ){ std::fprintf(stderr, "Can't bind %s\n", socketPath.c_str()); return EXIT_FAILURE; }
+
+  const int facility{1 << 3}; // LOG_USER
+  LoggerUtils::SyslogSink sink("testIdent", socketPath, facility);
+  check(sink.isConnected(), "sink connected to the receiver");
+
+  // header: "<PRI>Mmm dd hh:mm:ss ident[pid]: message", priority = facility | severity
+  auto errorRecord = buildRecord(1, "disk full");
+  sink.write(errorRecord);
+  sink.sync();
+  auto messageList = daemon.takeMessages();
+  check(messageList.size() == 1, "one datagram per line");
+  if( messageList.size() == 1 ){
+    check(messageList[0] == buildExpectedMessage(errorRecord, facility | 3 /* LOG_ERR */, "testIdent", "disk full"),
+          "RFC 3164 header, got \"" + messageList[0] + "\"");
+  }
+
+  // severities
+  check(LoggerUtils::SyslogSink::getSyslogPriority(0) == 2, "FATAL -> LOG_CRIT");
+  check(LoggerUtils::SyslogSink::getSyslogPriority(3) == 4, "WARNING -> LOG_WARNING");
+  check(LoggerUtils::SyslogSink::getSyslogPriority(4) == 6, "INFO -> LOG_INFO");
+  check(LoggerUtils::SyslogSink::getSyslogPriority(6) == 7, "TRACE -> LOG_DEBUG");
+
+  // batching: nothing is sent before the batch is full, synced or old enough. flush() is called at each std::endl.
+  for( int iLine = 0 ; iLine < LOGGER_SYSLOG_BATCH_SIZE - 1 ; iLine++ ){ sink.write(buildRecord(4, "line " + std::to_string(iLine))); sink.flush(); }
+  check(daemon.takeMessages().empty(), "lines held until the batch is full");
+  sink.write(buildRecord(4, "last line of the batch"));
+  messageList = daemon.takeMessages();
+  check(messageList.size() == LOGGER_SYSLOG_BATCH_SIZE, "full batch sent without flush, got " + std::to_string(messageList.size()));
+  if( not messageList.empty() ){
+    check(messageList.front().find("]: line 0") != std::string::npos, "batch order (first)");
+    check(messageList.back().find("]: last line of the batch") != std::string::npos, "batch order (last)");
+  }
+
+  sink.write(buildRecord(4, "partial batch"));
+  check(daemon.takeMessages().empty(), "partial batch held");
+  sink.sync();
+  check(daemon.takeMessages().size() == 1, "partial batch sent on sync");
+
+  sink.write(buildRecord(4, "quiet program"));
+  std::this_thread::sleep_for(std::chrono::milliseconds(int(2000 * LOGGER_SYSLOG_FLUSH_PERIOD))); // checked every half period
+  check(daemon.takeMessages().size() == 1, "partial batch sent after LOGGER_SYSLOG_FLUSH_PERIOD");
+
+  // pieces of line: one datagram per line, with the level of its first piece
+  sink.write(buildRecord(3, "progress: ", '\0'));
+  sink.write(buildRecord(4, "42%"));
+  sink.sync();
+  messageList = daemon.takeMessages();
+  check(messageList.size() == 1, "pieces gathered in one datagram");
+  if( messageList.size() == 1 ){
+    check(messageList[0].compare(0, 4, "<12>") == 0, "priority of the first piece");
+    check(messageList[0].find("]: progress: 42%") != std::string::npos, "pieces concatenated, got \"" + messageList[0] + "\"");
+  }
+
+  // through the logger: one std::endl per line, the batches are still full
+  auto loggerSink = std::make_shared<LoggerUtils::SyslogSink>("testIdent", socketPath, facility);
+  Logger::addSink(loggerSink, "syslog");
+  for( int iLine = 0 ; iLine < LOGGER_SYSLOG_BATCH_SIZE - 1 ; iLine++ ){ LogInfo << "logger line " << iLine << std::endl; }
+  check(daemon.takeMessages().empty(), "logger lines held until the batch is full");
+  LogInfo << "last logger line of the batch" << std::endl;
+  messageList = daemon.takeMessages();
+  check(messageList.size() == LOGGER_SYSLOG_BATCH_SIZE, "full batch sent through the logger, got " + std::to_string(messageList.size()));
+  if( not messageList.empty() ){
+    check(messageList.front().find("]: logger line 0") != std::string::npos, "logger batch order (first), got \"" + messageList.front() + "\"");
+  }
+  Logger::removeSink("syslog");
+
+  if( nFailures != 0 ){ std::fprintf(stderr, "%d check(s) failed\n", nFailures); return EXIT_FAILURE; }
+  std::printf("SyslogSink: all checks passed\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,157 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+// Prints the records of a binary log file (see LOGGER_WRITE_BINARY_OUTFILE) in the regular text format.
+// Only the blocks overlapping the requested time range and log level are read, thanks to the .idx file.
+
+#include "Logger.h"
+
+#include <ctime>
+#include <cstdio>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+
+namespace {
+
+  void printUsage(const char* exeName_){
+    std::fprintf(stderr,
+      "Usage: %s <file.blog> [options]\n"
+      "  --from <time>     first timestamp to print\n"
+      "  --to <time>       last timestamp to print\n"
+      "  --level <level>   max log level printed: FATAL, ERROR, ALERT, WARNING, INFO, DEBUG, TRACE or 0-6\n"
+      "  --color           colorize the prefix\n"
+      "<time> is either seconds since epoch, \"YYYY-mm-dd HH:MM:SS\" or \"HH:MM:SS\" (on the day of the first record)\n",
+      exeName_
+    );
+  }
+
+  bool parseLogLevel(const std::string& levelStr_, int& logLevel_){
+    if( levelStr_.size() == 1 and levelStr_[0] >= '0' and levelStr_[0] <= '6' ){
+      logLevel_ = levelStr_[0] - '0';
+      return true;
+    }
+    for( int iLevel = 0 ; iLevel <= static_cast<int>(Logger::LogLevel::TRACE) ; iLevel++ ){
+      auto levelName = LoggerUtils::toLowerCase(Logger::getLogLevelStr(static_cast<Logger::LogLevel>(iLevel)));
+      if( LoggerUtils::toLowerCase(levelStr_).find(levelName) == 0 ){
+        logLevel_ = iLevel;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool parseTimestamp(const std::string& timeStr_, uint64_t firstTimestamp_, uint64_t& timestamp_){
+    // sscanf rather than strptime (POSIX only): the tool also builds on Windows
+    struct tm timeInfo{};
+    int nChars{-1};
+
+    if( std::sscanf(timeStr_.c_str(), "%d-%d-%d %d:%d:%d%n", &timeInfo.tm_year, &timeInfo.tm_mon, &timeInfo.tm_mday,
+                    &timeInfo.tm_hour, &timeInfo.tm_min, &timeInfo.tm_sec, &nChars) == 6 and size_t(nChars) == timeStr_.size() ){
+      timeInfo.tm_year -= 1900;
+      timeInfo.tm_mon -= 1;
+      timeInfo.tm_isdst = -1;
+    }
+    else if( std::sscanf(timeStr_.c_str(), "%d:%d:%d%n", &timeInfo.tm_hour, &timeInfo.tm_min, &timeInfo.tm_sec, &nChars) == 3
+             and size_t(nChars) == timeStr_.size() ){
+      // take the day of the first record
+      auto firstTime = static_cast<time_t>(firstTimestamp_ / 1000000000ULL);
+      struct tm dayInfo = *localtime(&firstTime);
+      timeInfo.tm_year = dayInfo.tm_year;
+      timeInfo.tm_mon = dayInfo.tm_mon;
+      timeInfo.tm_mday = dayInfo.tm_mday;
+      timeInfo.tm_isdst = -1;
+    }
+    else{
+      char* numberEnd{nullptr};
+      double seconds = std::strtod(timeStr_.c_str(), &numberEnd);
+      if( numberEnd == timeStr_.c_str() or *numberEnd != '\0' or seconds < 0 ) return false;
+      timestamp_ = static_cast<uint64_t>(seconds * 1E9);
+      return true;
+    }
+
+    auto rawTime = std::mktime(&timeInfo);
+    if( rawTime < 0 ) return false;
+    timestamp_ = static_cast<uint64_t>(rawTime) * 1000000000ULL;
+    return true;
+  }
+
+}
+
+int main(int argc, char** argv){
+
+  if( argc < 2 ){ printUsage(argv[0]); return EXIT_FAILURE; }
+
+  std::string filePath;
+  std::string fromStr, toStr;
+  int maxLogLevel{static_cast<int>(Logger::LogLevel::TRACE)};
+  bool enableColors{false};
+
+  for( int iArg = 1 ; iArg < argc ; iArg++ ){
+    std::string arg{argv[iArg]};
+    bool hasValue{iArg + 1 < argc};
+    if     ( arg == "--from" and hasValue ){ fromStr = argv[++iArg]; }
+    else if( arg == "--to" and hasValue ){ toStr = argv[++iArg]; }
+    else if( arg == "--level" and hasValue ){
+      if( not parseLogLevel(argv[++iArg], maxLogLevel) ){
+        std::fprintf(stderr, "Invalid log level: %s\n", argv[iArg]);
+        return EXIT_FAILURE;
+      }
+    }
+    else if( arg == "--color" ){ enableColors = true; }
+    else if( arg == "-h" or arg == "--help" ){ printUsage(argv[0]); return EXIT_SUCCESS; }
+    else if( filePath.empty() and arg[0] != '-' ){ filePath = arg; }
+    else{ printUsage(argv[0]); return EXIT_FAILURE; }
+  }
+
+  LoggerUtils::BinaryLogReader reader;
+  if( not reader.open(filePath) ){
+    std::fprintf(stderr, "Could not open binary log file: %s\n", filePath.c_str());
+    return EXIT_FAILURE;
+  }
+
+  uint64_t fromTimestamp{0};
+  uint64_t toTimestamp{std::numeric_limits<uint64_t>::max()};
+  if( not fromStr.empty() and not parseTimestamp(fromStr, reader.getFirstTimestamp(), fromTimestamp) ){
+    std::fprintf(stderr, "Invalid time: %s\n", fromStr.c_str());
+    return EXIT_FAILURE;
+  }
+  if( not toStr.empty() and not parseTimestamp(toStr, reader.getFirstTimestamp(), toTimestamp) ){
+    std::fprintf(stderr, "Invalid time: %s\n", toStr.c_str());
+    return EXIT_FAILURE;
+  }
+
+  // printed with fwrite: std::cout is hooked by the logger and writes char by char
+  std::string lineBuffer;
+  char timeBuffer[128];
+  reader.readRecords(fromTimestamp, toTimestamp, maxLogLevel, [&](const LoggerUtils::BinaryLogReader::Record& record_){
+    auto logLevel = static_cast<Logger::LogLevel>(record_.logLevel);
+    auto rawTime = static_cast<time_t>(record_.timestamp / 1000000000ULL);
+    struct tm timeInfo = *localtime(&rawTime);
+    std::strftime(timeBuffer, sizeof(timeBuffer), LOGGER_TIME_FORMAT, &timeInfo);
+
+    lineBuffer = timeBuffer;
+    lineBuffer += ' ';
+    if( enableColors ) lineBuffer += Logger::getLogLevelColorStr(logLevel);
+    lineBuffer += LoggerUtils::padString(Logger::getLogLevelStr(logLevel), 5);
+    if( enableColors ) lineBuffer += LOGGER_STR_COLOR_RESET;
+    lineBuffer += ' ';
+    if( enableColors ) lineBuffer += LOGGER_STR_COLOR_LIGHT_GREY;
+    lineBuffer += (record_.fileName != nullptr ? *record_.fileName : "?");
+    lineBuffer += ':';
+    lineBuffer += std::to_string(record_.lineNumber);
+    lineBuffer += " (thread: ";
+    lineBuffer += std::to_string(record_.threadId);
+    lineBuffer += ')';
+    if( enableColors ) lineBuffer += LOGGER_STR_COLOR_RESET;
+    lineBuffer += ": ";
+    lineBuffer.append(record_.data, record_.size);
+    lineBuffer += '\n';
+    std::fwrite(lineBuffer.data(), 1, lineBuffer.size(), stdout);
+  });
+
+  return EXIT_SUCCESS;
+}
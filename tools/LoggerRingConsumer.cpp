@@ -0,0 +1,129 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+// Drains the shared memory ring written by a LoggerUtils::SharedRingSink into a file or stdout.
+// Stops once the producer process is gone and the ring is empty (unless --follow).
+
+#include "Logger.h"
+
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <csignal>
+#include <cstdlib>
+#include <algorithm>
+#include <sys/mman.h>
+
+
+namespace {
+
+  std::atomic<bool> isInterrupted{false};
+  void onInterrupt(int){ isInterrupted = true; }
+
+  void printUsage(const char* exeName_){
+    std::fprintf(stderr,
+      "Usage: %s <ring name> [options]\n"
+      "  -o <file>         append the lines to this file instead of stdout\n"
+      "  --level <level>   max log level written: FATAL, ERROR, ALERT, WARNING, INFO, DEBUG, TRACE or 0-6\n"
+      "  --poll <ms>       sleep time when the ring is empty (default: 10)\n"
+      "  --follow          keep running after the producer is gone (a new one can take over the ring)\n"
+      "  --unlink          remove the ring on exit\n"
+      "<ring name> is the name given to the SharedRingSink, e.g. \"/myjob-log\"\n",
+      exeName_
+    );
+  }
+
+  bool parseLogLevel(const std::string& levelStr_, int& logLevel_){
+    if( levelStr_.size() == 1 and levelStr_[0] >= '0' and levelStr_[0] <= '6' ){
+      logLevel_ = levelStr_[0] - '0';
+      return true;
+    }
+    for( int iLevel = 0 ; iLevel <= static_cast<int>(Logger::LogLevel::TRACE) ; iLevel++ ){
+      auto levelName = LoggerUtils::toLowerCase(Logger::getLogLevelStr(static_cast<Logger::LogLevel>(iLevel)));
+      if( LoggerUtils::toLowerCase(levelStr_).find(levelName) == 0 ){
+        logLevel_ = iLevel;
+        return true;
+      }
+    }
+    return false;
+  }
+
+}
+
+int main(int argc, char** argv){
+
+  if( argc < 2 ){ printUsage(argv[0]); return EXIT_FAILURE; }
+
+  std::string ringName;
+  std::string outputPath;
+  int maxLogLevel{static_cast<int>(Logger::LogLevel::TRACE)};
+  int pollPeriodMs{10};
+  bool follow{false};
+  bool unlinkOnExit{false};
+
+  for( int iArg = 1 ; iArg < argc ; iArg++ ){
+    std::string arg{argv[iArg]};
+    bool hasValue{iArg + 1 < argc};
+    if     ( arg == "-o" and hasValue ){ outputPath = argv[++iArg]; }
+    else if( arg == "--level" and hasValue ){
+      if( not parseLogLevel(argv[++iArg], maxLogLevel) ){
+        std::fprintf(stderr, "Invalid log level: %s\n", argv[iArg]);
+        return EXIT_FAILURE;
+      }
+    }
+    else if( arg == "--poll" and hasValue ){ pollPeriodMs = std::max(1, std::atoi(argv[++iArg])); }
+    else if( arg == "--follow" ){ follow = true; }
+    else if( arg == "--unlink" ){ unlinkOnExit = true; }
+    else if( arg == "-h" or arg == "--help" ){ printUsage(argv[0]); return EXIT_SUCCESS; }
+    else if( ringName.empty() and arg[0] != '-' ){ ringName = arg; }
+    else{ printUsage(argv[0]); return EXIT_FAILURE; }
+  }
+  if( ringName.empty() ){ printUsage(argv[0]); return EXIT_FAILURE; }
+  ringName = LoggerUtils::getSharedRingObjectName(ringName);
+
+  FILE* output = stdout;
+  if( not outputPath.empty() and (output = std::fopen(outputPath.c_str(), "a")) == nullptr ){
+    std::fprintf(stderr, "Could not open output file: %s\n", outputPath.c_str());
+    return EXIT_FAILURE;
+  }
+
+  std::signal(SIGINT, onInterrupt);
+  std::signal(SIGTERM, onInterrupt);
+  auto pollPeriod = std::chrono::milliseconds(pollPeriodMs);
+
+  // the producer might not be started yet
+  LoggerUtils::SharedRingReader reader;
+  while( not reader.open(ringName) ){
+    if( isInterrupted ) return EXIT_SUCCESS;
+    std::this_thread::sleep_for(pollPeriod);
+  }
+
+  // written with fwrite: std::cout is hooked by the logger
+  uint64_t nReportedOverruns{0};
+  auto writeLine = [&](int logLevel_, uint64_t, const char* data_, size_t size_){
+    if( logLevel_ <= maxLogLevel ) std::fwrite(data_, 1, size_, output);
+  };
+  while( true ){
+    bool isProducerAlive = reader.isProducerAlive(); // checked before reading: no line can be missed at exit
+    size_t nLines = reader.read(writeLine);
+
+    uint64_t nOverruns = reader.getNbOverruns();
+    if( nOverruns > nReportedOverruns ){
+      std::fprintf(stderr, "%s: %llu line(s) dropped by the producer (ring full)\n",
+                   ringName.c_str(), static_cast<unsigned long long>(nOverruns - nReportedOverruns));
+      nReportedOverruns = nOverruns;
+    }
+
+    if( nLines != 0 ){ std::fflush(output); continue; }
+    if( isInterrupted or (not isProducerAlive and not follow) ) break;
+    std::this_thread::sleep_for(pollPeriod);
+  }
+
+  if( output != stdout ) std::fclose(output);
+  reader.close();
+  if( unlinkOnExit ) ::shm_unlink(ringName.c_str());
+  return EXIT_SUCCESS;
+}
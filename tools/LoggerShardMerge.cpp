@@ -0,0 +1,130 @@
+//
+// Created by Nadrino on 18/10/2026.
+//
+
+// Merges the per-thread files written with Logger::setWriteInShardFiles() into one ordered stream.
+// Each shard is already sorted: a k-way merge only keeps one line per shard in memory.
+
+#include <queue>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <memory>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+
+
+namespace {
+
+  void printUsage(const char* exeName_){
+    std::fprintf(stderr,
+      "Usage: %s <shard files...> [options]\n"
+      "  -o <file>         write the merged lines to this file instead of stdout\n"
+      "  --by-time         order by timestamp (default: by sequence number, exact even if the clock jumps)\n"
+      "  --keep-keys       keep the \"<sequence number> <timestamp>\" columns\n"
+      "Example: %s myJob_20261018_101500_t*.log -o myJob.log\n",
+      exeName_, exeName_
+    );
+  }
+
+  struct ShardLine{
+    uint64_t sequenceNumber{0};
+    uint64_t timestamp{0};
+    size_t textOffset{0}; // after the keys
+    std::string line{};
+  };
+
+  bool parseKeys(ShardLine& line_){
+    // "<sequence number> <timestamp> <text>"
+    // the keys are only updated if both are valid
+    const char* begin = line_.line.c_str();
+    char* end{nullptr};
+    uint64_t sequenceNumber = std::strtoull(begin, &end, 10);
+    if( end == begin or *end != ' ' ) return false;
+    const char* timeBegin = end + 1;
+    uint64_t timestamp = std::strtoull(timeBegin, &end, 10);
+    if( end == timeBegin or *end != ' ' ) return false;
+    line_.sequenceNumber = sequenceNumber;
+    line_.timestamp = timestamp;
+    line_.textOffset = size_t(end + 1 - begin);
+    return true;
+  }
+
+  struct Shard{
+    std::ifstream stream{};
+    ShardLine current{};
+
+    bool next(){
+      if( not std::getline(stream, current.line) ) return false;
+      // a line without keys (truncated by a killed job) keeps the previous ones
+      if( not parseKeys(current) ) current.textOffset = 0;
+      return true;
+    }
+  };
+
+}
+
+int main(int argc, char** argv){
+
+  if( argc < 2 ){ printUsage(argv[0]); return EXIT_FAILURE; }
+
+  std::vector<std::string> shardPathList;
+  std::string outputPath;
+  bool byTime{false};
+  bool keepKeys{false};
+
+  for( int iArg = 1 ; iArg < argc ; iArg++ ){
+    std::string arg{argv[iArg]};
+    bool hasValue{iArg + 1 < argc};
+    if     ( arg == "-o" and hasValue ){ outputPath = argv[++iArg]; }
+    else if( arg == "--by-time" ){ byTime = true; }
+    else if( arg == "--keep-keys" ){ keepKeys = true; }
+    else if( arg == "-h" or arg == "--help" ){ printUsage(argv[0]); return EXIT_SUCCESS; }
+    else if( arg[0] != '-' ){ shardPathList.emplace_back(arg); }
+    else{ printUsage(argv[0]); return EXIT_FAILURE; }
+  }
+  if( shardPathList.empty() ){ printUsage(argv[0]); return EXIT_FAILURE; }
+
+  FILE* output = stdout;
+  if( not outputPath.empty() and (output = std::fopen(outputPath.c_str(), "w")) == nullptr ){
+    std::fprintf(stderr, "Could not open output file: %s\n", outputPath.c_str());
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::unique_ptr<Shard>> shardList;
+  for( auto& shardPath : shardPathList ){
+    shardList.emplace_back(new Shard());
+    shardList.back()->stream.open(shardPath);
+    if( not shardList.back()->stream.is_open() ){
+      std::fprintf(stderr, "Could not open shard: %s\n", shardPath.c_str());
+      return EXIT_FAILURE;
+    }
+  }
+
+  // min-heap on (key, tie-breaker) of the current line of each shard
+  auto isAfter = [&](size_t a_, size_t b_){
+    const ShardLine& a = shardList[a_]->current;
+    const ShardLine& b = shardList[b_]->current;
+    if( byTime and a.timestamp != b.timestamp ) return a.timestamp > b.timestamp;
+    return a.sequenceNumber > b.sequenceNumber;
+  };
+  std::priority_queue<size_t, std::vector<size_t>, std::function<bool(size_t, size_t)>> heap(isAfter);
+  for( size_t iShard = 0 ; iShard < shardList.size() ; iShard++ ){
+    if( shardList[iShard]->next() ) heap.push(iShard);
+  }
+
+  while( not heap.empty() ){
+    size_t iShard = heap.top();
+    heap.pop();
+    const ShardLine& line = shardList[iShard]->current;
+    size_t offset = ( keepKeys ? 0 : line.textOffset );
+    std::fwrite(line.line.data() + offset, 1, line.line.size() - offset, output);
+    std::fputc('\n', output);
+    if( shardList[iShard]->next() ) heap.push(iShard);
+  }
+
+  if( output != stdout ) std::fclose(output);
+  return EXIT_SUCCESS;
+}